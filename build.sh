@@ -1,11 +1,16 @@
 #!/bin/bash
 clear
-gcc -o pisplay main.c pisplay.c fmopl.c logo.c -lSDL2 -lSDL2_ttf -lm && \
+# fmopl_tables.h is generated; to rebuild or verify it:
+#   gcc -o mkopltab mkopltab.c -lm && ./mkopltab > fmopl_tables.h
+#   ./mkopltab --check fmopl_tables.h
+gcc -o pisplay main.c pisplay.c fmopl.c logo.c -lSDL2 -lSDL2_ttf -lm -pthread && \
+gcc -O2 -o pisrender pisrender.c pisplay.c fmopl.c -DPISPLAY_NO_SDL -lm -pthread && \
+./pisrender --pack tunes.pak tunes && \
 rm *.o &>/dev/null ; \
 emcc -Os main.c pisplay.c fmopl.c logo.c -s WASM=1 -s USE_SDL=2 -s USE_SDL_TTF=2 -s MODULARIZE=1 -o pisplay.js \
-     --embed-file tunes --embed-file assets
+     --embed-file tunes.pak --embed-file assets
 
-# gcc -o pisplay main.c pisplay.c fmopl_linux.o logo_linux.o -lSDL2 -lSDL2_ttf -lm && \
+# gcc -o pisplay main.c pisplay.c fmopl_linux.o logo_linux.o -lSDL2 -lSDL2_ttf -lm -pthread && \
 # rm pisplay.o &>/dev/null ; \
 # emcc main.c pisplay.c fmopl_emscripten.o logo_emscripten.o -s WASM=1 -s USE_SDL=2 -s USE_SDL_TTF=2 -s MODULARIZE=1 -o pisplay.js \
 #      --embed-file tunes --embed-file assets
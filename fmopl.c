@@ -43,6 +43,7 @@
 #include <string.h>
 #include <stdarg.h>
 #include <math.h>
+#include <pthread.h>
 //#include "driver.h"		/* use M.A.M.E. */
 #include "fmopl.h"
 
@@ -50,6 +51,14 @@
 #define PI 3.14159265358979323846
 #endif
 
+/* AVX2 channel kernel , x86 gcc/clang only , selected at runtime */
+#if OPL_USE_SIMD && (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define OPL_SIMD_AVX2 1
+#include <immintrin.h>
+#else
+#define OPL_SIMD_AVX2 0
+#endif
+
 /* -------------------- for debug --------------------- */
 /* #define OPL_OUTPUT_LOG */
 #ifdef OPL_OUTPUT_LOG
@@ -189,18 +198,11 @@ static const INT32 SL_TABLE[16]={
 /* TotalLevel : 48 24 12  6  3 1.5 0.75 (dB) */
 /* TL_TABLE[ 0      to TL_MAX          ] : plus  section */
 /* TL_TABLE[ TL_MAX to TL_MAX+TL_MAX-1 ] : minus section */
-static INT32 *TL_TABLE;
-
-/* pointers to TL_TABLE with sinwave output offset */
-static INT32 **SIN_TABLE;
-
-/* LFO table */
-static INT32 *AMS_TABLE;
-static INT32 *VIB_TABLE;
-
-/* envelope output curve table */
-/* attack + decay + OFF */
-static INT32 ENV_CURVE[2*EG_ENT+1];
+/* SIN_TABLE[ wave*SIN_ENT + phase ] : TL_TABLE offset of sinwave output */
+/* ENV_CURVE : envelope output curve table , attack + decay + OFF */
+/* AMS_TABLE,VIB_TABLE : LFO table */
+/* all of them are generated by mkopltab.c */
+#include "fmopl_tables.h"
 
 /* multiple table */
 #define ML 2
@@ -212,30 +214,14 @@ static const UINT32 MUL_TABLE[16]= {
 #undef ML
 
 /* dummy attack / decay rate ( when rate == 0 ) */
-static INT32 RATE_0[16]=
+static const INT32 RATE_0[16]=
 {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
 
 /* -------------------- static state --------------------- */
 
-/* lock level of common table */
-static int num_lock = 0;
-
-/* work table */
-static void *cur_chip = NULL;	/* current chip point */
-/* currenct chip state */
-/* static OPLSAMPLE  *bufL,*bufR; */
-static OPL_CH *S_CH;
-static OPL_CH *E_CH;
-OPL_SLOT *SLOT7_1,*SLOT7_2,*SLOT8_1,*SLOT8_2;
-
-static INT32 outd[1];
-static INT32 ams;
-static INT32 vib;
-INT32  *ams_table;
-INT32  *vib_table;
-static INT32 amsIncr;
-static INT32 vibIncr;
-static INT32 feedback2;		/* connect for SLOT 2 */
+/* cache of clock / rate dependent tables */
+static OPL_RATE *rate_list = NULL;
+static pthread_mutex_t rate_lock = PTHREAD_MUTEX_INITIALIZER;
 
 /* log output level */
 #define LOG_ERR  3      /* ERROR       */
@@ -326,50 +312,54 @@ INLINE void OPL_KEYOFF(OPL_SLOT *SLOT)
 	}
 }
 
+/* ---------- envelope generator phase change ---------- */
+INLINE void OPL_EG_NEXT( OPL_SLOT *SLOT )
+{
+	switch( SLOT->evm ){
+	case ENV_MOD_AR: /* ATTACK -> DECAY1 */
+		/* next DR */
+		SLOT->evm = ENV_MOD_DR;
+		SLOT->evc = EG_DST;
+		SLOT->eve = SLOT->SL;
+		SLOT->evs = SLOT->evsd;
+		break;
+	case ENV_MOD_DR: /* DECAY -> SL or RR */
+		SLOT->evc = SLOT->SL;
+		SLOT->eve = EG_DED;
+		if(SLOT->eg_typ)
+		{
+			SLOT->evs = 0;
+		}
+		else
+		{
+			SLOT->evm = ENV_MOD_RR;
+			SLOT->evs = SLOT->evsr;
+		}
+		break;
+	case ENV_MOD_RR: /* RR -> OFF */
+		SLOT->evc = EG_OFF;
+		SLOT->eve = EG_OFF+1;
+		SLOT->evs = 0;
+		break;
+	}
+}
+
 /* ---------- calcrate Envelope Generator & Phase Generator ---------- */
 /* return : envelope output */
-INLINE UINT32 OPL_CALC_SLOT( OPL_SLOT *SLOT )
+INLINE UINT32 OPL_CALC_SLOT( FM_OPL *OPL, OPL_SLOT *SLOT )
 {
 	/* calcrate envelope generator */
 	if( (SLOT->evc+=SLOT->evs) >= SLOT->eve )
-	{
-		switch( SLOT->evm ){
-		case ENV_MOD_AR: /* ATTACK -> DECAY1 */
-			/* next DR */
-			SLOT->evm = ENV_MOD_DR;
-			SLOT->evc = EG_DST;
-			SLOT->eve = SLOT->SL;
-			SLOT->evs = SLOT->evsd;
-			break;
-		case ENV_MOD_DR: /* DECAY -> SL or RR */
-			SLOT->evc = SLOT->SL;
-			SLOT->eve = EG_DED;
-			if(SLOT->eg_typ)
-			{
-				SLOT->evs = 0;
-			}
-			else
-			{
-				SLOT->evm = ENV_MOD_RR;
-				SLOT->evs = SLOT->evsr;
-			}
-			break;
-		case ENV_MOD_RR: /* RR -> OFF */
-			SLOT->evc = EG_OFF;
-			SLOT->eve = EG_OFF+1;
-			SLOT->evs = 0;
-			break;
-		}
-	}
+		OPL_EG_NEXT(SLOT);
 	/* calcrate envelope */
-	return SLOT->TLL+ENV_CURVE[SLOT->evc>>ENV_BITS]+(SLOT->ams ? ams : 0);
+	return SLOT->TLL+ENV_CURVE[SLOT->evc>>ENV_BITS]+(SLOT->ams ? OPL->ams : 0);
 }
 
 /* set algorythm connection */
-static void set_algorythm( OPL_CH *CH)
+static void set_algorythm( FM_OPL *OPL, OPL_CH *CH)
 {
-	INT32 *carrier = &outd[0];
-	CH->connect1 = CH->CON ? carrier : &feedback2;
+	INT32 *carrier = &OPL->outd[0];
+	CH->connect1 = CH->CON ? carrier : &OPL->feedback2;
 	CH->connect2 = carrier;
 }
 
@@ -431,11 +421,11 @@ INLINE void set_ar_dr(FM_OPL *OPL,int slot,int v)
 	int ar = v>>4;
 	int dr = v&0x0f;
 
-	SLOT->AR = ar ? &OPL->AR_TABLE[ar<<2] : RATE_0;
+	SLOT->AR = ar ? &OPL->tables->AR_TABLE[ar<<2] : RATE_0;
 	SLOT->evsa = SLOT->AR[SLOT->ksr];
 	if( SLOT->evm == ENV_MOD_AR ) SLOT->evs = SLOT->evsa;
 
-	SLOT->DR = dr ? &OPL->DR_TABLE[dr<<2] : RATE_0;
+	SLOT->DR = dr ? &OPL->tables->DR_TABLE[dr<<2] : RATE_0;
 	SLOT->evsd = SLOT->DR[SLOT->ksr];
 	if( SLOT->evm == ENV_MOD_DR ) SLOT->evs = SLOT->evsd;
 }
@@ -450,27 +440,27 @@ INLINE void set_sl_rr(FM_OPL *OPL,int slot,int v)
 
 	SLOT->SL = SL_TABLE[sl];
 	if( SLOT->evm == ENV_MOD_DR ) SLOT->eve = SLOT->SL;
-	SLOT->RR = &OPL->DR_TABLE[rr<<2];
+	SLOT->RR = &OPL->tables->DR_TABLE[rr<<2];
 	SLOT->evsr = SLOT->RR[SLOT->ksr];
 	if( SLOT->evm == ENV_MOD_RR ) SLOT->evs = SLOT->evsr;
 }
 
 /* operator output calcrator */
-#define OP_OUT(slot,env,con)   slot->wavetable[((slot->Cnt+con)/(0x1000000/SIN_ENT))&(SIN_ENT-1)][env]
+#define OP_OUT(slot,env,con)   TL_TABLE[slot->wavetable[((slot->Cnt+con)/(0x1000000/SIN_ENT))&(SIN_ENT-1)]+(env)]
 /* ---------- calcrate one of channel ---------- */
-INLINE void OPL_CALC_CH( OPL_CH *CH )
+INLINE void OPL_CALC_CH( FM_OPL *OPL, OPL_CH *CH )
 {
 	UINT32 env_out;
 	OPL_SLOT *SLOT;
 
-	feedback2 = 0;
+	OPL->feedback2 = 0;
 	/* SLOT 1 */
 	SLOT = &CH->SLOT[SLOT1];
-	env_out=OPL_CALC_SLOT(SLOT);
+	env_out=OPL_CALC_SLOT(OPL,SLOT);
 	if( env_out < EG_ENT-1 )
 	{
 		/* PG */
-		if(SLOT->vib) SLOT->Cnt += (SLOT->Incr*vib/VIB_RATE);
+		if(SLOT->vib) SLOT->Cnt += (SLOT->Incr*OPL->vib/VIB_RATE);
 		else          SLOT->Cnt += SLOT->Incr;
 		/* connectoion */
 		if(CH->FB)
@@ -490,232 +480,219 @@ INLINE void OPL_CALC_CH( OPL_CH *CH )
 	}
 	/* SLOT 2 */
 	SLOT = &CH->SLOT[SLOT2];
-	env_out=OPL_CALC_SLOT(SLOT);
+	env_out=OPL_CALC_SLOT(OPL,SLOT);
 	if( env_out < EG_ENT-1 )
 	{
 		/* PG */
-		if(SLOT->vib) SLOT->Cnt += (SLOT->Incr*vib/VIB_RATE);
+		if(SLOT->vib) SLOT->Cnt += (SLOT->Incr*OPL->vib/VIB_RATE);
 		else          SLOT->Cnt += SLOT->Incr;
 		/* connectoion */
-		outd[0] += OP_OUT(SLOT,env_out, feedback2);
+		OPL->outd[0] += OP_OUT(SLOT,env_out, OPL->feedback2);
 	}
 }
 
+/* ---------- channel activity ---------- */
+/* A slot parked at EG_OFF neither moves its envelope nor its phase. */
+/* Once the feedback history has drained as well , OPL_CALC_CH has   */
+/* nothing to do for the channel until the next key on.              */
+INLINE int OPL_SLOT_IDLE( OPL_SLOT *SLOT )
+{
+	return SLOT->evc == EG_OFF && SLOT->evs == 0 && SLOT->eve > EG_OFF;
+}
+
+INLINE int OPL_CH_IDLE( OPL_CH *CH )
+{
+	return OPL_SLOT_IDLE(&CH->SLOT[SLOT1]) && OPL_SLOT_IDLE(&CH->SLOT[SLOT2]) &&
+		CH->op1_out[0] == 0 && CH->op1_out[1] == 0;
+}
+
+INLINE int OPL_IDLE( FM_OPL *OPL )
+{
+	int c;
+
+	for( c = 0 ; c < 9 ; c++ )
+		if( !OPL_CH_IDLE(&OPL->P_CH[c]) ) return 0;
+	return 1;
+}
+
 /* ---------- calcrate rythm block ---------- */
 #define WHITE_NOISE_db 6.0
-INLINE void OPL_CALC_RH( OPL_CH *CH )
+/* noise generator : 23 bit LFSR of the chip , taps 22 and 8,1,0 */
+#define NOISE_RNG_POLY 0x800302
+INLINE void OPL_CALC_RH( FM_OPL *OPL, OPL_CH *CH )
 {
 	UINT32 env_tam,env_sd,env_top,env_hh;
-	int whitenoise = (rand()&1)*(WHITE_NOISE_db/EG_STEP);
+	int whitenoise = (OPL->noise_rng&1)*(WHITE_NOISE_db/EG_STEP);
 	INT32 tone8;
 
 	OPL_SLOT *SLOT;
+	OPL_SLOT *SLOT7_1 = &CH[7].SLOT[SLOT1];
+	OPL_SLOT *SLOT7_2 = &CH[7].SLOT[SLOT2];
+	OPL_SLOT *SLOT8_1 = &CH[8].SLOT[SLOT1];
+	OPL_SLOT *SLOT8_2 = &CH[8].SLOT[SLOT2];
 	int env_out;
 
 	/* BD : same as FM serial mode and output level is large */
-	feedback2 = 0;
+	OPL->feedback2 = 0;
 	/* SLOT 1 */
 	SLOT = &CH[6].SLOT[SLOT1];
-	env_out=OPL_CALC_SLOT(SLOT);
+	env_out=OPL_CALC_SLOT(OPL,SLOT);
 	if( env_out < EG_ENT-1 )
 	{
 		/* PG */
-		if(SLOT->vib) SLOT->Cnt += (SLOT->Incr*vib/VIB_RATE);
+		if(SLOT->vib) SLOT->Cnt += (SLOT->Incr*OPL->vib/VIB_RATE);
 		else          SLOT->Cnt += SLOT->Incr;
 		/* connectoion */
 		if(CH[6].FB)
 		{
 			int feedback1 = (CH[6].op1_out[0]+CH[6].op1_out[1])>>CH[6].FB;
 			CH[6].op1_out[1] = CH[6].op1_out[0];
-			feedback2 = CH[6].op1_out[0] = OP_OUT(SLOT,env_out,feedback1);
+			OPL->feedback2 = CH[6].op1_out[0] = OP_OUT(SLOT,env_out,feedback1);
 		}
 		else
 		{
-			feedback2 = OP_OUT(SLOT,env_out,0);
+			OPL->feedback2 = OP_OUT(SLOT,env_out,0);
 		}
 	}else
 	{
-		feedback2 = 0;
+		OPL->feedback2 = 0;
 		CH[6].op1_out[1] = CH[6].op1_out[0];
 		CH[6].op1_out[0] = 0;
 	}
 	/* SLOT 2 */
 	SLOT = &CH[6].SLOT[SLOT2];
-	env_out=OPL_CALC_SLOT(SLOT);
+	env_out=OPL_CALC_SLOT(OPL,SLOT);
 	if( env_out < EG_ENT-1 )
 	{
 		/* PG */
-		if(SLOT->vib) SLOT->Cnt += (SLOT->Incr*vib/VIB_RATE);
+		if(SLOT->vib) SLOT->Cnt += (SLOT->Incr*OPL->vib/VIB_RATE);
 		else          SLOT->Cnt += SLOT->Incr;
 		/* connectoion */
-		outd[0] += OP_OUT(SLOT,env_out, feedback2)*2;
+		OPL->outd[0] += OP_OUT(SLOT,env_out, OPL->feedback2)*2;
 	}
 
 	// SD  (17) = mul14[fnum7] + white noise
 	// TAM (15) = mul15[fnum8]
 	// TOP (18) = fnum6(mul18[fnum8]+whitenoise)
 	// HH  (14) = fnum7(mul18[fnum8]+whitenoise) + white noise
-	env_sd =OPL_CALC_SLOT(SLOT7_2) + whitenoise;
-	env_tam=OPL_CALC_SLOT(SLOT8_1);
-	env_top=OPL_CALC_SLOT(SLOT8_2);
-	env_hh =OPL_CALC_SLOT(SLOT7_1) + whitenoise;
+	env_sd =OPL_CALC_SLOT(OPL,SLOT7_2) + whitenoise;
+	env_tam=OPL_CALC_SLOT(OPL,SLOT8_1);
+	env_top=OPL_CALC_SLOT(OPL,SLOT8_2);
+	env_hh =OPL_CALC_SLOT(OPL,SLOT7_1) + whitenoise;
 
 	/* PG */
-	if(SLOT7_1->vib) SLOT7_1->Cnt += (2*SLOT7_1->Incr*vib/VIB_RATE);
+	if(SLOT7_1->vib) SLOT7_1->Cnt += (2*SLOT7_1->Incr*OPL->vib/VIB_RATE);
 	else             SLOT7_1->Cnt += 2*SLOT7_1->Incr;
-	if(SLOT7_2->vib) SLOT7_2->Cnt += ((CH[7].fc*8)*vib/VIB_RATE);
+	if(SLOT7_2->vib) SLOT7_2->Cnt += ((CH[7].fc*8)*OPL->vib/VIB_RATE);
 	else             SLOT7_2->Cnt += (CH[7].fc*8);
-	if(SLOT8_1->vib) SLOT8_1->Cnt += (SLOT8_1->Incr*vib/VIB_RATE);
+	if(SLOT8_1->vib) SLOT8_1->Cnt += (SLOT8_1->Incr*OPL->vib/VIB_RATE);
 	else             SLOT8_1->Cnt += SLOT8_1->Incr;
-	if(SLOT8_2->vib) SLOT8_2->Cnt += ((CH[8].fc*48)*vib/VIB_RATE);
+	if(SLOT8_2->vib) SLOT8_2->Cnt += ((CH[8].fc*48)*OPL->vib/VIB_RATE);
 	else             SLOT8_2->Cnt += (CH[8].fc*48);
 
 	tone8 = OP_OUT(SLOT8_2,whitenoise,0 );
 
 	/* SD */
 	if( env_sd < EG_ENT-1 )
-		outd[0] += OP_OUT(SLOT7_1,env_sd, 0)*8;
+		OPL->outd[0] += OP_OUT(SLOT7_1,env_sd, 0)*8;
 	/* TAM */
 	if( env_tam < EG_ENT-1 )
-		outd[0] += OP_OUT(SLOT8_1,env_tam, 0)*2;
+		OPL->outd[0] += OP_OUT(SLOT8_1,env_tam, 0)*2;
 	/* TOP-CY */
 	if( env_top < EG_ENT-1 )
-		outd[0] += OP_OUT(SLOT7_2,env_top,tone8)*2;
+		OPL->outd[0] += OP_OUT(SLOT7_2,env_top,tone8)*2;
 	/* HH */
 	if( env_hh  < EG_ENT-1 )
-		outd[0] += OP_OUT(SLOT7_2,env_hh,tone8)*2;
+		OPL->outd[0] += OP_OUT(SLOT7_2,env_hh,tone8)*2;
+
+	/* noise generator , one step per sample */
+	if( OPL->noise_rng & 1 ) OPL->noise_rng ^= NOISE_RNG_POLY;
+	OPL->noise_rng >>= 1;
 }
 
 /* ----------- initialize time tabls ----------- */
-static void init_timetables( FM_OPL *OPL , int ARRATE , int DRRATE )
+static void init_timetables( OPL_RATE *T , double freqbase , int ARRATE , int DRRATE )
 {
 	int i;
 	double rate;
 
 	/* make attack rate & decay rate tables */
-	for (i = 0;i < 4;i++) OPL->AR_TABLE[i] = OPL->DR_TABLE[i] = 0;
+	for (i = 0;i < 4;i++) T->AR_TABLE[i] = T->DR_TABLE[i] = 0;
 	for (i = 4;i <= 60;i++){
-		rate  = OPL->freqbase;						/* frequency rate */
+		rate  = freqbase;							/* frequency rate */
 		if( i < 60 ) rate *= 1.0+(i&3)*0.25;		/* b0-1 : x1 , x1.25 , x1.5 , x1.75 */
 		rate *= 1<<((i>>2)-1);						/* b2-5 : shift bit */
 		rate *= (double)(EG_ENT<<ENV_BITS);
-		OPL->AR_TABLE[i] = rate / ARRATE;
-		OPL->DR_TABLE[i] = rate / DRRATE;
+		T->AR_TABLE[i] = rate / ARRATE;
+		T->DR_TABLE[i] = rate / DRRATE;
 	}
 	for (i = 60;i < 75;i++)
 	{
-		OPL->AR_TABLE[i] = EG_AED-1;
-		OPL->DR_TABLE[i] = OPL->DR_TABLE[60];
+		T->AR_TABLE[i] = EG_AED-1;
+		T->DR_TABLE[i] = T->DR_TABLE[60];
 	}
 #if 0
 	for (i = 0;i < 64 ;i++){	/* make for overflow area */
 		LOG(LOG_WAR,("rate %2d , ar %f ms , dr %f ms \n",i,
-			((double)(EG_ENT<<ENV_BITS) / OPL->AR_TABLE[i]) * (1000.0 / OPL->rate),
-			((double)(EG_ENT<<ENV_BITS) / OPL->DR_TABLE[i]) * (1000.0 / OPL->rate) ));
+			((double)(EG_ENT<<ENV_BITS) / T->AR_TABLE[i]) * (1000.0 / T->rate),
+			((double)(EG_ENT<<ENV_BITS) / T->DR_TABLE[i]) * (1000.0 / T->rate) ));
 	}
 #endif
 }
 
-/* ---------- generic table initialize ---------- */
-static int OPLOpenTable( void )
+/* get the tables for a clock / rate pair , building them on first use */
+static const OPL_RATE *OPL_LockRate( int clock , int rate , double freqbase )
 {
-	int s,t;
-	double rate;
-	int i,j;
-	double pom;
+	OPL_RATE *T;
+	int fn;
 
-	/* allocate dynamic tables */
-	if( (TL_TABLE = malloc(TL_MAX*2*sizeof(INT32))) == NULL)
-		return 0;
-	if( (SIN_TABLE = malloc(SIN_ENT*4 *sizeof(INT32 *))) == NULL)
-	{
-		free(TL_TABLE);
-		return 0;
-	}
-	if( (AMS_TABLE = malloc(AMS_ENT*2 *sizeof(INT32))) == NULL)
+	pthread_mutex_lock(&rate_lock);
+	for( T = rate_list ; T ; T = T->next )
+		if( T->clock == clock && T->rate == rate ) break;
+	if( T == NULL )
 	{
-		free(TL_TABLE);
-		free(SIN_TABLE);
-		return 0;
-	}
-	if( (VIB_TABLE = malloc(VIB_ENT*2 *sizeof(INT32))) == NULL)
-	{
-		free(TL_TABLE);
-		free(SIN_TABLE);
-		free(AMS_TABLE);
-		return 0;
-	}
-	/* make total level table */
-	for (t = 0;t < EG_ENT-1 ;t++){
-		rate = ((1<<TL_BITS)-1)/pow(10,EG_STEP*t/20);	/* dB -> voltage */
-		TL_TABLE[       t] =  (int)rate;
-		TL_TABLE[TL_MAX+t] = -TL_TABLE[t];
-/*		LOG(LOG_INF,("TotalLevel(%3d) = %x\n",t,TL_TABLE[t]));*/
-	}
-	/* fill volume off area */
-	for ( t = EG_ENT-1; t < TL_MAX ;t++){
-		TL_TABLE[t] = TL_TABLE[TL_MAX+t] = 0;
+		T = malloc(sizeof(OPL_RATE));
+		if( T != NULL )
+		{
+			T->clock = clock;
+			T->rate  = rate;
+			T->refcount = 0;
+			/* make time tables */
+			init_timetables( T , freqbase , OPL_ARRATE , OPL_DRRATE );
+			/* make fnumber -> increment counter table */
+			for( fn=0 ; fn < 1024 ; fn++ )
+			{
+				T->FN_TABLE[fn] = freqbase * fn * FREQ_RATE * (1<<7) / 2;
+			}
+			T->next = rate_list;
+			rate_list = T;
+		}
 	}
+	if( T != NULL ) T->refcount++;
+	pthread_mutex_unlock(&rate_lock);
+	return T;
+}
 
-	/* make sinwave table (total level offet) */
-	/* degree 0 = degree 180                   = off */
-	SIN_TABLE[0] = SIN_TABLE[SIN_ENT/2]         = &TL_TABLE[EG_ENT-1];
-	for (s = 1;s <= SIN_ENT/4;s++){
-		pom = sin(2*PI*s/SIN_ENT); /* sin     */
-		pom = 20*log10(1/pom);	   /* decibel */
-		j = pom / EG_STEP;         /* TL_TABLE steps */
-
-        /* degree 0   -  90    , degree 180 -  90 : plus section */
-		SIN_TABLE[          s] = SIN_TABLE[SIN_ENT/2-s] = &TL_TABLE[j];
-        /* degree 180 - 270    , degree 360 - 270 : minus section */
-		SIN_TABLE[SIN_ENT/2+s] = SIN_TABLE[SIN_ENT  -s] = &TL_TABLE[TL_MAX+j];
-/*		LOG(LOG_INF,("sin(%3d) = %f:%f db\n",s,pom,(double)j * EG_STEP));*/
-	}
-	for (s = 0;s < SIN_ENT;s++)
-	{
-		SIN_TABLE[SIN_ENT*1+s] = s<(SIN_ENT/2) ? SIN_TABLE[s] : &TL_TABLE[EG_ENT];
-		SIN_TABLE[SIN_ENT*2+s] = SIN_TABLE[s % (SIN_ENT/2)];
-		SIN_TABLE[SIN_ENT*3+s] = (s/(SIN_ENT/4))&1 ? &TL_TABLE[EG_ENT] : SIN_TABLE[SIN_ENT*2+s];
-	}
+/* drop a reference , the last chip frees the tables */
+static void OPL_UnLockRate( const OPL_RATE *tables )
+{
+	OPL_RATE **p;
 
-	/* envelope counter -> envelope output table */
-	for (i=0; i<EG_ENT; i++)
-	{
-		/* ATTACK curve */
-		pom = pow( ((double)(EG_ENT-1-i)/EG_ENT) , 8 ) * EG_ENT;
-		/* if( pom >= EG_ENT ) pom = EG_ENT-1; */
-		ENV_CURVE[i] = (int)pom;
-		/* DECAY ,RELEASE curve */
-		ENV_CURVE[(EG_DST>>ENV_BITS)+i]= i;
-	}
-	/* off */
-	ENV_CURVE[EG_OFF>>ENV_BITS]= EG_ENT-1;
-	/* make LFO ams table */
-	for (i=0; i<AMS_ENT; i++)
-	{
-		pom = (1.0+sin(2*PI*i/AMS_ENT))/2; /* sin */
-		AMS_TABLE[i]         = (1.0/EG_STEP)*pom; /* 1dB   */
-		AMS_TABLE[AMS_ENT+i] = (4.8/EG_STEP)*pom; /* 4.8dB */
-	}
-	/* make LFO vibrate table */
-	for (i=0; i<VIB_ENT; i++)
+	pthread_mutex_lock(&rate_lock);
+	for( p = &rate_list ; *p ; p = &(*p)->next )
 	{
-		/* 100cent = 1seminote = 6% ?? */
-		pom = (double)VIB_RATE*0.06*sin(2*PI*i/VIB_ENT); /* +-100sect step */
-		VIB_TABLE[i]         = VIB_RATE + (pom*0.07); /* +- 7cent */
-		VIB_TABLE[VIB_ENT+i] = VIB_RATE + (pom*0.14); /* +-14cent */
-		/* LOG(LOG_INF,("vib %d=%d\n",i,VIB_TABLE[VIB_ENT+i])); */
+		if( *p == tables )
+		{
+			OPL_RATE *T = *p;
+			if( --T->refcount == 0 )
+			{
+				*p = T->next;
+				free(T);
+			}
+			break;
+		}
 	}
-	return 1;
-}
-
-
-static void OPLCloseTable( void )
-{
-	free(TL_TABLE);
-	free(SIN_TABLE);
-	free(AMS_TABLE);
-	free(VIB_TABLE);
+	pthread_mutex_unlock(&rate_lock);
 }
 
 /* CSM Key Controll */
@@ -736,24 +713,19 @@ INLINE void CSMKeyControll(OPL_CH *CH)
 }
 
 /* ---------- opl initialize ---------- */
-static void OPL_initalize(FM_OPL *OPL)
+static int OPL_initalize(FM_OPL *OPL)
 {
-	int fn;
-
 	/* frequency base */
 	OPL->freqbase = (OPL->rate) ? ((double)OPL->clock / OPL->rate) / 72  : 0;
 	/* Timer base time */
 	OPL->TimerBase = 1.0/((double)OPL->clock / 72.0 );
-	/* make time tables */
-	init_timetables( OPL , OPL_ARRATE , OPL_DRRATE );
-	/* make fnumber -> increment counter table */
-	for( fn=0 ; fn < 1024 ; fn++ )
-	{
-		OPL->FN_TABLE[fn] = OPL->freqbase * fn * FREQ_RATE * (1<<7) / 2;
-	}
+	/* time tables and fnumber -> increment counter table */
+	OPL->tables = OPL_LockRate( OPL->clock , OPL->rate , OPL->freqbase );
+	if( OPL->tables == NULL ) return -1;
 	/* LFO freq.table */
 	OPL->amsIncr = OPL->rate ? (double)AMS_ENT*(1<<AMS_SHIFT) / OPL->rate * 3.7 * ((double)OPL->clock/3600000) : 0;
 	OPL->vibIncr = OPL->rate ? (double)VIB_ENT*(1<<VIB_SHIFT) / OPL->rate * 6.4 * ((double)OPL->clock/3600000) : 0;
+	return 0;
 }
 
 /* ---------- write a OPL registers ---------- */
@@ -983,7 +955,7 @@ static void OPLWriteReg(FM_OPL *OPL, int r, int v)
 			CH->block_fnum = block_fnum;
 
 			CH->ksl_base = KSL_TABLE[block_fnum>>6];
-			CH->fc = OPL->FN_TABLE[fnum]>>blockRv;
+			CH->fc = OPL->tables->FN_TABLE[fnum]>>blockRv;
 			CH->kcode = CH->block_fnum>>9;
 			if( (OPL->mode&0x40) && CH->block_fnum&0x100) CH->kcode |=1;
 			CALC_FCSLOT(CH,&CH->SLOT[SLOT1]);
@@ -998,7 +970,7 @@ static void OPLWriteReg(FM_OPL *OPL, int r, int v)
 		int feedback = (v>>1)&7;
 		CH->FB   = feedback ? (8+1) - feedback : 0;
 		CH->CON = v&1;
-		set_algorythm(CH);
+		set_algorythm(OPL,CH);
 		}
 		return;
 	case 0xe0: /* wave type */
@@ -1014,35 +986,350 @@ static void OPLWriteReg(FM_OPL *OPL, int r, int v)
 	}
 }
 
-/* lock/unlock for common table */
-static int OPL_LockTable(void)
+#if (BUILD_YM3812 || BUILD_YM3526)
+/*******************************************************************************/
+/*		YM3812 local section                                                   */
+/*******************************************************************************/
+
+#if OPL_SIMD_AVX2
+/*******************************************************************************/
+/*		AVX2 channel kernel                                                    */
+/*******************************************************************************/
+/* Eight channels are computed at once , one per vector lane. The lanes are   */
+/* either channel 0-7 of one chip (YM3812UpdateOne) or the same channel of    */
+/* eight chips (OPLBankUpdate). The hot slot state is copied into             */
+/* structure-of-arrays form for one update call and written back afterwards , */
+/* so between calls OPL_CH / OPL_SLOT stay the master copy. Envelope phase    */
+/* changes are rare and handed back to OPL_EG_NEXT lane by lane. The output   */
+/* is bit-identical to the scalar path.                                       */
+
+#define OPL_AVX2 __attribute__((target("avx2")))
+
+/* below this many busy channels the scalar loop is faster */
+#define OPL_AVX2_MIN_CH 5
+
+/* slot state of eight lanes */
+typedef struct {
+	__m256i Cnt,Incr;		/* phase generator                */
+	__m256i evc,eve,evs;	/* envelope generator             */
+	__m256i TLL;
+	__m256i ams,vib;		/* -1 : LFO enabled               */
+	__m256i wave;			/* SIN_TABLE offset of wavetable  */
+} OPL_SLOT8;
+
+/* channel state of eight lanes */
+typedef struct {
+	OPL_CH *CH[8];			/* master copy of each lane       */
+	OPL_SLOT8 SLOT[2];
+	__m256i FB,fbon;		/* fbon -1 : feedback enabled     */
+	__m256i con;			/* -1 : CON=1                     */
+	__m256i op1_out[2];
+} OPL_CH8;
+
+static int OPL_HaveAVX2(void)
+{
+	return __builtin_cpu_supports("avx2");
+}
+
+OPL_AVX2 static void OPL_CH8_LOAD(OPL_CH8 *C8)
+{
+	INT32 Cnt[8],Incr[8],evc[8],eve[8],evs[8],TLL[8],ams[8],vib[8],wave[8];
+	INT32 FB[8],fbon[8],con[8],op1_out0[8],op1_out1[8];
+	int c,s;
+
+	for(s=0;s<2;s++)
+	{
+		OPL_SLOT8 *S8 = &C8->SLOT[s];
+
+		for(c=0;c<8;c++)
+		{
+			OPL_SLOT *SLOT = &C8->CH[c]->SLOT[s];
+			Cnt[c]  = SLOT->Cnt;
+			Incr[c] = SLOT->Incr;
+			evc[c]  = SLOT->evc;
+			eve[c]  = SLOT->eve;
+			evs[c]  = SLOT->evs;
+			TLL[c]  = SLOT->TLL;
+			ams[c]  = SLOT->ams ? -1 : 0;
+			vib[c]  = SLOT->vib ? -1 : 0;
+			wave[c] = SLOT->wavetable - SIN_TABLE;
+		}
+		S8->Cnt  = _mm256_loadu_si256((const __m256i *)Cnt);
+		S8->Incr = _mm256_loadu_si256((const __m256i *)Incr);
+		S8->evc  = _mm256_loadu_si256((const __m256i *)evc);
+		S8->eve  = _mm256_loadu_si256((const __m256i *)eve);
+		S8->evs  = _mm256_loadu_si256((const __m256i *)evs);
+		S8->TLL  = _mm256_loadu_si256((const __m256i *)TLL);
+		S8->ams  = _mm256_loadu_si256((const __m256i *)ams);
+		S8->vib  = _mm256_loadu_si256((const __m256i *)vib);
+		S8->wave = _mm256_loadu_si256((const __m256i *)wave);
+	}
+	for(c=0;c<8;c++)
+	{
+		OPL_CH *CH = C8->CH[c];
+		FB[c]   = CH->FB;
+		fbon[c] = CH->FB ? -1 : 0;
+		con[c]  = CH->CON ? -1 : 0;
+		op1_out0[c] = CH->op1_out[0];
+		op1_out1[c] = CH->op1_out[1];
+	}
+	C8->FB   = _mm256_loadu_si256((const __m256i *)FB);
+	C8->fbon = _mm256_loadu_si256((const __m256i *)fbon);
+	C8->con  = _mm256_loadu_si256((const __m256i *)con);
+	C8->op1_out[0] = _mm256_loadu_si256((const __m256i *)op1_out0);
+	C8->op1_out[1] = _mm256_loadu_si256((const __m256i *)op1_out1);
+}
+
+OPL_AVX2 static void OPL_CH8_STORE(OPL_CH8 *C8)
 {
-	num_lock++;
-	if(num_lock>1) return 0;
-	/* first time */
-	cur_chip = NULL;
-	/* allocate total level table (128kb space) */
-	if( !OPLOpenTable() )
+	INT32 Cnt[8],evc[8],eve[8],evs[8],op1_out0[8],op1_out1[8];
+	int c,s;
+
+	for(s=0;s<2;s++)
 	{
-		num_lock--;
-		return -1;
+		OPL_SLOT8 *S8 = &C8->SLOT[s];
+
+		_mm256_storeu_si256((__m256i *)Cnt,S8->Cnt);
+		_mm256_storeu_si256((__m256i *)evc,S8->evc);
+		_mm256_storeu_si256((__m256i *)eve,S8->eve);
+		_mm256_storeu_si256((__m256i *)evs,S8->evs);
+		for(c=0;c<8;c++)
+		{
+			OPL_SLOT *SLOT = &C8->CH[c]->SLOT[s];
+			SLOT->Cnt = Cnt[c];
+			SLOT->evc = evc[c];
+			SLOT->eve = eve[c];
+			SLOT->evs = evs[c];
+		}
+	}
+	_mm256_storeu_si256((__m256i *)op1_out0,C8->op1_out[0]);
+	_mm256_storeu_si256((__m256i *)op1_out1,C8->op1_out[1]);
+	for(c=0;c<8;c++)
+	{
+		C8->CH[c]->op1_out[0] = op1_out0[c];
+		C8->CH[c]->op1_out[1] = op1_out1[c];
 	}
-	return 0;
 }
 
-static void OPL_UnLockTable(void)
+/* envelope phase change for the lanes set in 'mask' */
+OPL_AVX2 __attribute__((noinline)) static void OPL_SLOT8_EG(OPL_CH8 *C8,int s,int mask)
 {
-	if(num_lock) num_lock--;
-	if(num_lock) return;
-	/* last time */
-	cur_chip = NULL;
-	OPLCloseTable();
+	OPL_SLOT8 *S8 = &C8->SLOT[s];
+	INT32 evc[8],eve[8],evs[8];
+	int c;
+
+	_mm256_storeu_si256((__m256i *)evc,S8->evc);
+	_mm256_storeu_si256((__m256i *)eve,S8->eve);
+	_mm256_storeu_si256((__m256i *)evs,S8->evs);
+	for(c=0;c<8;c++)
+	{
+		if( mask & (1<<c) )
+		{
+			OPL_SLOT *SLOT = &C8->CH[c]->SLOT[s];
+			SLOT->evc = evc[c];
+			OPL_EG_NEXT(SLOT);
+			evc[c] = SLOT->evc;
+			eve[c] = SLOT->eve;
+			evs[c] = SLOT->evs;
+		}
+	}
+	S8->evc = _mm256_loadu_si256((const __m256i *)evc);
+	S8->eve = _mm256_loadu_si256((const __m256i *)eve);
+	S8->evs = _mm256_loadu_si256((const __m256i *)evs);
 }
 
-#if (BUILD_YM3812 || BUILD_YM3526)
-/*******************************************************************************/
-/*		YM3812 local section                                                   */
-/*******************************************************************************/
+/* envelope generator , returns envelope output (OPL_CALC_SLOT) */
+OPL_AVX2 static inline __m256i OPL_SLOT8_ENV(OPL_CH8 *C8,int s,__m256i ams)
+{
+	OPL_SLOT8 *S8 = &C8->SLOT[s];
+	int mask;
+	__m256i curve;
+
+	S8->evc = _mm256_add_epi32(S8->evc,S8->evs);
+	/* lanes with evc >= eve */
+	mask = ~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(S8->eve,S8->evc))) & 0xff;
+	if( mask ) OPL_SLOT8_EG(C8,s,mask);
+	/* ENV_CURVE is linear past the attack section , gather only for attack */
+	curve = _mm256_srai_epi32(S8->evc,ENV_BITS);
+	if( _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(EG_ENT),curve))) )
+	{
+		curve = _mm256_i32gather_epi32((const int *)ENV_CURVE,curve,2);
+		curve = _mm256_and_si256(curve,_mm256_set1_epi32(0xffff));
+	}
+	else
+	{
+		curve = _mm256_min_epi32(_mm256_sub_epi32(curve,_mm256_set1_epi32(EG_ENT)),_mm256_set1_epi32(EG_ENT-1));
+	}
+	return _mm256_add_epi32(_mm256_add_epi32(S8->TLL,curve),_mm256_and_si256(S8->ams,ams));
+}
+
+/* phase generator for the lanes in 'active' */
+OPL_AVX2 static inline void OPL_SLOT8_PG(OPL_SLOT8 *S8,__m256i active,__m256i vib)
+{
+	__m256i incr = _mm256_blendv_epi8(S8->Incr,
+		_mm256_srli_epi32(_mm256_mullo_epi32(S8->Incr,vib),8),	/* Incr*vib/VIB_RATE */
+		S8->vib);
+	S8->Cnt = _mm256_add_epi32(S8->Cnt,_mm256_and_si256(incr,active));
+}
+
+/* operator output (OP_OUT) , 0 for the lanes not in 'active' */
+OPL_AVX2 static inline __m256i OPL_SLOT8_OUT(OPL_SLOT8 *S8,__m256i env,__m256i con,__m256i active)
+{
+	__m256i phase = _mm256_srli_epi32(_mm256_add_epi32(S8->Cnt,con),24-11);	/* /(0x1000000/SIN_ENT) */
+	__m256i sin;
+
+	phase = _mm256_and_si256(phase,_mm256_set1_epi32(SIN_ENT-1));
+	sin = _mm256_i32gather_epi32((const int *)SIN_TABLE,_mm256_add_epi32(S8->wave,phase),2);
+	sin = _mm256_and_si256(sin,_mm256_set1_epi32(0xffff));
+	return _mm256_mask_i32gather_epi32(_mm256_setzero_si256(),(const int *)TL_TABLE,
+		_mm256_add_epi32(sin,env),active,4);
+}
+
+/* one sample of eight channels (OPL_CALC_CH) , returns channel output */
+OPL_AVX2 static inline __m256i OPL_CH8_CALC(OPL_CH8 *C8,__m256i ams,__m256i vib)
+{
+	const __m256i off = _mm256_set1_epi32(EG_ENT-1);
+	__m256i env,active,feedback1,out1,out2,update;
+
+	/* SLOT 1 */
+	env = OPL_SLOT8_ENV(C8,SLOT1,ams);
+	active = _mm256_cmpgt_epi32(off,env);
+	OPL_SLOT8_PG(&C8->SLOT[SLOT1],active,vib);
+	feedback1 = _mm256_add_epi32(C8->op1_out[0],C8->op1_out[1]);
+	feedback1 = _mm256_and_si256(_mm256_srav_epi32(feedback1,C8->FB),C8->fbon);
+	out1 = OPL_SLOT8_OUT(&C8->SLOT[SLOT1],env,feedback1,active);
+	/* feedback history moves on when feedback is used or the slot is off */
+	update = _mm256_or_si256(_mm256_xor_si256(active,_mm256_set1_epi32(-1)),C8->fbon);
+	C8->op1_out[1] = _mm256_blendv_epi8(C8->op1_out[1],C8->op1_out[0],update);
+	C8->op1_out[0] = _mm256_blendv_epi8(C8->op1_out[0],out1,update);
+
+	/* SLOT 2 */
+	env = OPL_SLOT8_ENV(C8,SLOT2,ams);
+	active = _mm256_cmpgt_epi32(off,env);
+	OPL_SLOT8_PG(&C8->SLOT[SLOT2],active,vib);
+	out2 = OPL_SLOT8_OUT(&C8->SLOT[SLOT2],env,_mm256_andnot_si256(C8->con,out1),active);
+
+	/* connection */
+	return _mm256_add_epi32(out2,_mm256_and_si256(C8->con,out1));
+}
+
+/* channel 0-7 of one chip in the vector , channel 8 scalar */
+OPL_AVX2 static void OPL_CALC_AVX2(FM_OPL *OPL,OPLSAMPLE *buf,int length)
+{
+	OPL_CH *S_CH = OPL->P_CH;
+	UINT32 amsCnt  = OPL->amsCnt;
+	UINT32 vibCnt  = OPL->vibCnt;
+	UINT32 amsIncr = OPL->amsIncr;
+	UINT32 vibIncr = OPL->vibIncr;
+	const INT32 *ams_table = OPL->ams_table;
+	const INT32 *vib_table = OPL->vib_table;
+	OPL_CH8 C8;
+	__m256i out;
+	__m128i sum;
+	int c,i,data;
+
+	for(c=0;c<8;c++) C8.CH[c] = &S_CH[c];
+	OPL_CH8_LOAD(&C8);
+
+	for( i=0; i < length ; i++ )
+	{
+		/* LFO */
+		OPL->ams = ams_table[(amsCnt+=amsIncr)>>AMS_SHIFT];
+		OPL->vib = vib_table[(vibCnt+=vibIncr)>>VIB_SHIFT];
+		/* channel 0-7 */
+		out = OPL_CH8_CALC(&C8,_mm256_set1_epi32(OPL->ams),_mm256_set1_epi32(OPL->vib));
+		sum = _mm_add_epi32(_mm256_castsi256_si128(out),_mm256_extracti128_si256(out,1));
+		sum = _mm_add_epi32(sum,_mm_shuffle_epi32(sum,0x4e));
+		sum = _mm_add_epi32(sum,_mm_shuffle_epi32(sum,0xb1));
+		/* channel 8 */
+		OPL->outd[0] = 0;
+		_mm256_zeroupper();	/* OPL_CALC_CH is SSE code */
+		OPL_CALC_CH(OPL,&S_CH[8]);
+		/* limit check */
+		data = Limit( OPL->outd[0] + _mm_cvtsi128_si32(sum) , OPL_MAXOUT, OPL_MINOUT );
+		/* store to sound buffer */
+		buf[i] = data >> OPL_OUTSB;
+	}
+
+	OPL_CH8_STORE(&C8);
+	OPL->amsCnt = amsCnt;
+	OPL->vibCnt = vibCnt;
+}
+
+/* all 9 channels of up to eight chips , one chip per lane */
+OPL_AVX2 static void OPL_BANK_CALC_AVX2(FM_OPL **chip,int num,OPLSAMPLE **buffer,int length)
+{
+	OPL_CH8 C8[9];
+	OPL_CH idle[8];
+	INT32 amsCnt[8],amsIncr[8],amsOfs[8],vibCnt[8],vibIncr[8],vibOfs[8];
+	INT32 out[8];
+	__m256i ams_cnt,ams_incr,ams_ofs,vib_cnt,vib_incr,vib_ofs;
+	int c,k,i;
+
+	/* unused lanes run a silent channel */
+	memset(idle,0,sizeof(idle));
+	for(k=num;k<8;k++)
+	{
+		idle[k].SLOT[SLOT1].wavetable = idle[k].SLOT[SLOT2].wavetable = &SIN_TABLE[0];
+		idle[k].SLOT[SLOT1].evc = idle[k].SLOT[SLOT2].evc = EG_OFF;
+		idle[k].SLOT[SLOT1].eve = idle[k].SLOT[SLOT2].eve = EG_OFF+1;
+	}
+	for(c=0;c<9;c++)
+	{
+		for(k=0;k<8;k++) C8[c].CH[k] = k<num ? &chip[k]->P_CH[c] : &idle[k];
+		OPL_CH8_LOAD(&C8[c]);
+	}
+	for(k=0;k<8;k++)
+	{
+		FM_OPL *OPL = chip[k<num ? k : 0];
+		amsCnt[k]  = OPL->amsCnt;
+		amsIncr[k] = OPL->amsIncr;
+		amsOfs[k]  = OPL->ams_table - AMS_TABLE;
+		vibCnt[k]  = OPL->vibCnt;
+		vibIncr[k] = OPL->vibIncr;
+		vibOfs[k]  = OPL->vib_table - VIB_TABLE;
+	}
+	ams_cnt  = _mm256_loadu_si256((const __m256i *)amsCnt);
+	ams_incr = _mm256_loadu_si256((const __m256i *)amsIncr);
+	ams_ofs  = _mm256_loadu_si256((const __m256i *)amsOfs);
+	vib_cnt  = _mm256_loadu_si256((const __m256i *)vibCnt);
+	vib_incr = _mm256_loadu_si256((const __m256i *)vibIncr);
+	vib_ofs  = _mm256_loadu_si256((const __m256i *)vibOfs);
+
+	for( i=0; i < length ; i++ )
+	{
+		__m256i ams,vib,outd;
+
+		/* LFO */
+		ams_cnt = _mm256_add_epi32(ams_cnt,ams_incr);
+		vib_cnt = _mm256_add_epi32(vib_cnt,vib_incr);
+		ams = _mm256_i32gather_epi32((const int *)AMS_TABLE,
+			_mm256_add_epi32(ams_ofs,_mm256_srli_epi32(ams_cnt,AMS_SHIFT)),4);
+		vib = _mm256_i32gather_epi32((const int *)VIB_TABLE,
+			_mm256_add_epi32(vib_ofs,_mm256_srli_epi32(vib_cnt,VIB_SHIFT)),4);
+		/* FM part */
+		outd = OPL_CH8_CALC(&C8[0],ams,vib);
+		for(c=1;c<9;c++)
+			outd = _mm256_add_epi32(outd,OPL_CH8_CALC(&C8[c],ams,vib));
+		/* limit check */
+		outd = _mm256_min_epi32(outd,_mm256_set1_epi32(OPL_MAXOUT));
+		outd = _mm256_max_epi32(outd,_mm256_set1_epi32(OPL_MINOUT));
+		/* store to sound buffers */
+		_mm256_storeu_si256((__m256i *)out,_mm256_srai_epi32(outd,OPL_OUTSB));
+		for(k=0;k<num;k++) buffer[k][i] = out[k];
+	}
+
+	for(c=0;c<9;c++) OPL_CH8_STORE(&C8[c]);
+	_mm256_storeu_si256((__m256i *)amsCnt,ams_cnt);
+	_mm256_storeu_si256((__m256i *)vibCnt,vib_cnt);
+	for(k=0;k<num;k++)
+	{
+		chip[k]->amsCnt = amsCnt[k];
+		chip[k]->vibCnt = vibCnt[k];
+		chip[k]->sample_time += length;
+	}
+}
+#endif /* OPL_SIMD_AVX2 */
 
 /* ---------- update one of chip ----------- */
 void YM3812UpdateOne(FM_OPL *OPL, INT16 *buffer, int length)
@@ -1052,47 +1339,61 @@ void YM3812UpdateOne(FM_OPL *OPL, INT16 *buffer, int length)
 	OPLSAMPLE *buf = buffer;
 	UINT32 amsCnt  = OPL->amsCnt;
 	UINT32 vibCnt  = OPL->vibCnt;
+	UINT32 amsIncr = OPL->amsIncr;
+	UINT32 vibIncr = OPL->vibIncr;
+	const INT32 *ams_table = OPL->ams_table;
+	const INT32 *vib_table = OPL->vib_table;
 	UINT8 rythm = OPL->rythm&0x20;
+	OPL_CH *S_CH = OPL->P_CH;
+	OPL_CH *E_CH = &S_CH[9];
 	OPL_CH *CH,*R_CH;
+	OPL_CH *A_CH[9];	/* channels with work in this block */
+	int a,active = 0;
 
-	if( (void *)OPL != cur_chip ){
-		cur_chip = (void *)OPL;
-		/* channel pointers */
-		S_CH = OPL->P_CH;
-		E_CH = &S_CH[9];
-		/* rythm slot */
-		SLOT7_1 = &S_CH[7].SLOT[SLOT1];
-		SLOT7_2 = &S_CH[7].SLOT[SLOT2];
-		SLOT8_1 = &S_CH[8].SLOT[SLOT1];
-		SLOT8_2 = &S_CH[8].SLOT[SLOT2];
-		/* LFO state */
-		amsIncr = OPL->amsIncr;
-		vibIncr = OPL->vibIncr;
-		ams_table = OPL->ams_table;
-		vib_table = OPL->vib_table;
-	}
 	R_CH = rythm ? &S_CH[6] : E_CH;
-    for( i=0; i < length ; i++ )
+	/* channels that stay idle for the whole block are skipped */
+	for(CH=S_CH ; CH < R_CH ; CH++)
+		if( !OPL_CH_IDLE(CH) ) A_CH[active++] = CH;
+
+	if( active == 0 && !rythm )
 	{
-		/*            channel A         channel B         channel C      */
-		/* LFO */
-		ams = ams_table[(amsCnt+=amsIncr)>>AMS_SHIFT];
-		vib = vib_table[(vibCnt+=vibIncr)>>VIB_SHIFT];
-		outd[0] = 0;
-		/* FM part */
-		for(CH=S_CH ; CH < R_CH ; CH++)
-			OPL_CALC_CH(CH);
-		/* Rythn part */
-		if(rythm)
-			OPL_CALC_RH(S_CH);
-		/* limit check */
-		data = Limit( outd[0] , OPL_MAXOUT, OPL_MINOUT );
-		/* store to sound buffer */
-		buf[i] = data >> OPL_OUTSB;
+		/* nothing keyed on and every envelope off : silent block */
+		memset(buf,0,length*sizeof(OPLSAMPLE));
+		OPL->amsCnt = amsCnt + amsIncr*length;
+		OPL->vibCnt = vibCnt + vibIncr*length;
 	}
+	else
+#if OPL_SIMD_AVX2
+	if( !rythm && active >= OPL_AVX2_MIN_CH && OPL_HaveAVX2() )
+	{
+		OPL_CALC_AVX2(OPL,buf,length);
+	}
+	else
+#endif
+	{
+		for( i=0; i < length ; i++ )
+		{
+			/*            channel A         channel B         channel C      */
+			/* LFO */
+			OPL->ams = ams_table[(amsCnt+=amsIncr)>>AMS_SHIFT];
+			OPL->vib = vib_table[(vibCnt+=vibIncr)>>VIB_SHIFT];
+			OPL->outd[0] = 0;
+			/* FM part */
+			for(a=0 ; a < active ; a++)
+				OPL_CALC_CH(OPL,A_CH[a]);
+			/* Rythn part */
+			if(rythm)
+				OPL_CALC_RH(OPL,S_CH);
+			/* limit check */
+			data = Limit( OPL->outd[0] , OPL_MAXOUT, OPL_MINOUT );
+			/* store to sound buffer */
+			buf[i] = data >> OPL_OUTSB;
+		}
 
-	OPL->amsCnt = amsCnt;
-	OPL->vibCnt = vibCnt;
+		OPL->amsCnt = amsCnt;
+		OPL->vibCnt = vibCnt;
+	}
+	OPL->sample_time += length;
 #ifdef OPL_OUTPUT_LOG
 	if(opl_dbg_fp)
 	{
@@ -1102,6 +1403,324 @@ void YM3812UpdateOne(FM_OPL *OPL, INT16 *buffer, int length)
 	}
 #endif
 }
+
+/* ----------  update a bank of independent chips in lockstep ---------- */
+/* buffer[n] receives 'length' samples of chip[n]. Up to OPL_BANK_LANES  */
+/* chips are rendered per pass , one chip per vector lane. Chips in      */
+/* rhythm mode , or all chips without AVX2 , go through YM3812UpdateOne. */
+void YM3812UpdateBank(FM_OPL **chip, INT16 **buffer, int num, int length)
+{
+	int n;
+#if OPL_SIMD_AVX2
+	FM_OPL *lane_chip[OPL_BANK_LANES];
+	OPLSAMPLE *lane_buf[OPL_BANK_LANES];
+	int lanes = 0;
+
+	if( OPL_HaveAVX2() )
+	{
+		for(n=0;n<num;n++)
+		{
+			/* rhythm mode and silent chips are not worth a lane */
+			if( (chip[n]->rythm&0x20) || OPL_IDLE(chip[n]) )
+			{
+				YM3812UpdateOne(chip[n],buffer[n],length);
+				continue;
+			}
+			lane_chip[lanes] = chip[n];
+			lane_buf[lanes]  = buffer[n];
+			if( ++lanes == OPL_BANK_LANES )
+			{
+				OPL_BANK_CALC_AVX2(lane_chip,lanes,lane_buf,length);
+				lanes = 0;
+			}
+		}
+		/* a single chip is faster with its channels in the lanes */
+		if( lanes == 1 )
+			YM3812UpdateOne(lane_chip[0],lane_buf[0],length);
+		else if( lanes )
+			OPL_BANK_CALC_AVX2(lane_chip,lanes,lane_buf,length);
+		return;
+	}
+#endif
+	for(n=0;n<num;n++)
+		YM3812UpdateOne(chip[n],buffer[n],length);
+}
+
+/* ---------- advance without output ---------- */
+/* The state a slot reaches in 'length' samples , without the operator */
+/* output. Runs of samples without an envelope phase change have a     */
+/* monotonic envelope , so the samples that move the phase counter are */
+/* counted from the ends of the run instead of one by one. Vibrato     */
+/* slots are stepped per sample. return : samples with the slot on     */
+#define OPL_SLOT_ENV(SLOT,evc) ((UINT32)((SLOT)->TLL+ENV_CURVE[(evc)>>ENV_BITS]))
+
+static int OPL_SKIP_SLOT( FM_OPL *OPL, OPL_SLOT *SLOT, UINT32 amsCnt, UINT32 vibCnt, int length )
+{
+	/* AM level at the top of the sine */
+	UINT32 ams_max = SLOT->ams ? OPL->ams_table[AMS_ENT/4] : 0;
+	UINT32 env_out;
+	int on = 0;
+
+	if( SLOT->vib )
+	{
+		while( length-- )
+		{
+			amsCnt += OPL->amsIncr;
+			vibCnt += OPL->vibIncr;
+			if( (SLOT->evc+=SLOT->evs) >= SLOT->eve )
+				OPL_EG_NEXT(SLOT);
+			env_out = OPL_SLOT_ENV(SLOT,SLOT->evc)+(SLOT->ams ? OPL->ams_table[amsCnt>>AMS_SHIFT] : 0);
+			if( env_out < EG_ENT-1 )
+			{
+				SLOT->Cnt += (SLOT->Incr*OPL->vib_table[vibCnt>>VIB_SHIFT]/VIB_RATE);
+				on++;
+			}
+		}
+		return on;
+	}
+
+	while( length > 0 )
+	{
+		INT32 evc = SLOT->evc;
+		INT32 evs = SLOT->evs;
+		INT32 end = SLOT->eve;
+		int run,count,j;
+
+		/* attack and decay/release parts of ENV_CURVE are monotonic apart */
+		if( evc < EG_DST && end > EG_DST ) end = EG_DST;
+		/* samples before the next phase change */
+		if( evc + evs >= SLOT->eve ) run = 0;
+		else if( evs == 0 ) run = length;
+		else
+		{
+			run = (end - 1 - evc) / evs;
+			if( run > length ) run = length;
+		}
+		if( run > 0 )
+		{
+			UINT32 first = OPL_SLOT_ENV(SLOT,evc+evs);
+			UINT32 last  = OPL_SLOT_ENV(SLOT,evc+run*evs);
+
+			if( first + ams_max < EG_ENT-1 && last + ams_max < EG_ENT-1 ) count = run;
+			else if( first >= EG_ENT-1 && last >= EG_ENT-1 ) count = 0;
+			else if( !SLOT->ams )
+			{
+				/* sample 1 and sample 'run' differ , find the change */
+				int a = 1, b = run;
+				while( b - a > 1 )
+				{
+					int mid = (a + b) / 2;
+					if( (OPL_SLOT_ENV(SLOT,evc+mid*evs) < EG_ENT-1) == (last < EG_ENT-1) ) b = mid;
+					else a = mid;
+				}
+				count = first < EG_ENT-1 ? a : run - b + 1;
+			}
+			else
+			{
+				/* AM decides , look at each sample */
+				UINT32 cnt = amsCnt;
+				count = 0;
+				for( j = 1 ; j <= run ; j++ )
+					if( OPL_SLOT_ENV(SLOT,evc+j*evs)+OPL->ams_table[(cnt+=OPL->amsIncr)>>AMS_SHIFT] < EG_ENT-1 )
+						count++;
+			}
+			SLOT->evc = evc + run*evs;
+			SLOT->Cnt += SLOT->Incr*count;
+			amsCnt += OPL->amsIncr*run;
+			on += count;
+			length -= run;
+		}
+		else
+		{
+			/* one sample with the phase change (or the attack/decay seam) */
+			amsCnt += OPL->amsIncr;
+			if( (SLOT->evc+=SLOT->evs) >= SLOT->eve )
+				OPL_EG_NEXT(SLOT);
+			env_out = OPL_SLOT_ENV(SLOT,SLOT->evc)+(SLOT->ams ? OPL->ams_table[amsCnt>>AMS_SHIFT] : 0);
+			if( env_out < EG_ENT-1 )
+			{
+				SLOT->Cnt += SLOT->Incr;
+				on++;
+			}
+			length--;
+		}
+	}
+	return on;
+}
+
+/* slot 1 of a feedback channel , per sample for the feedback history */
+static void OPL_SKIP_FB( FM_OPL *OPL, OPL_CH *CH, UINT32 amsCnt, UINT32 vibCnt, int length )
+{
+	OPL_SLOT *SLOT = &CH->SLOT[SLOT1];
+	UINT32 env_out;
+
+	while( length-- )
+	{
+		OPL->ams = OPL->ams_table[(amsCnt+=OPL->amsIncr)>>AMS_SHIFT];
+		OPL->vib = OPL->vib_table[(vibCnt+=OPL->vibIncr)>>VIB_SHIFT];
+		env_out=OPL_CALC_SLOT(OPL,SLOT);
+		if( env_out < EG_ENT-1 )
+		{
+			int feedback1 = (CH->op1_out[0]+CH->op1_out[1])>>CH->FB;
+			if(SLOT->vib) SLOT->Cnt += (SLOT->Incr*OPL->vib/VIB_RATE);
+			else          SLOT->Cnt += SLOT->Incr;
+			CH->op1_out[1] = CH->op1_out[0];
+			CH->op1_out[0] = OP_OUT(SLOT,env_out,feedback1);
+		}
+		else
+		{
+			CH->op1_out[1] = CH->op1_out[0];
+			CH->op1_out[0] = 0;
+		}
+	}
+}
+
+#if OPL_SIMD_AVX2
+/* slot 1 of up to eight feedback channels , one per lane */
+#define OPL_AVX2_MIN_FB 3
+
+OPL_AVX2 static void OPL_SKIP_FB_AVX2( FM_OPL *OPL, OPL_CH **fb, int num, int length )
+{
+	const __m256i off = _mm256_set1_epi32(EG_ENT-1);
+	UINT32 amsCnt = OPL->amsCnt;
+	UINT32 vibCnt = OPL->vibCnt;
+	OPL_CH8 C8;
+	OPL_CH idle[8];
+	__m256i env,active,feedback1,out1,update;
+	int k,i;
+
+	/* unused lanes run a silent channel */
+	memset(idle,0,sizeof(idle));
+	for(k=0;k<8;k++)
+	{
+		idle[k].SLOT[SLOT1].wavetable = idle[k].SLOT[SLOT2].wavetable = &SIN_TABLE[0];
+		idle[k].SLOT[SLOT1].evc = idle[k].SLOT[SLOT2].evc = EG_OFF;
+		idle[k].SLOT[SLOT1].eve = idle[k].SLOT[SLOT2].eve = EG_OFF+1;
+		C8.CH[k] = k<num ? fb[k] : &idle[k];
+	}
+	OPL_CH8_LOAD(&C8);
+
+	for( i=0; i < length ; i++ )
+	{
+		__m256i ams = _mm256_set1_epi32(OPL->ams_table[(amsCnt+=OPL->amsIncr)>>AMS_SHIFT]);
+		__m256i vib = _mm256_set1_epi32(OPL->vib_table[(vibCnt+=OPL->vibIncr)>>VIB_SHIFT]);
+
+		/* SLOT 1 of OPL_CH8_CALC */
+		env = OPL_SLOT8_ENV(&C8,SLOT1,ams);
+		active = _mm256_cmpgt_epi32(off,env);
+		OPL_SLOT8_PG(&C8.SLOT[SLOT1],active,vib);
+		feedback1 = _mm256_add_epi32(C8.op1_out[0],C8.op1_out[1]);
+		feedback1 = _mm256_and_si256(_mm256_srav_epi32(feedback1,C8.FB),C8.fbon);
+		out1 = OPL_SLOT8_OUT(&C8.SLOT[SLOT1],env,feedback1,active);
+		update = _mm256_or_si256(_mm256_xor_si256(active,_mm256_set1_epi32(-1)),C8.fbon);
+		C8.op1_out[1] = _mm256_blendv_epi8(C8.op1_out[1],C8.op1_out[0],update);
+		C8.op1_out[0] = _mm256_blendv_epi8(C8.op1_out[0],out1,update);
+	}
+	OPL_CH8_STORE(&C8);
+	_mm256_zeroupper();
+}
+#endif
+
+/* Advance the chip as YM3812UpdateOne would , without rendering. Only */
+/* the slot 1 output of feedback channels is needed for the state.     */
+void YM3812SkipOne(FM_OPL *OPL, int length)
+{
+	UINT32 amsCnt = OPL->amsCnt;
+	UINT32 vibCnt = OPL->vibCnt;
+	OPL_CH *A_CH[9],*F_CH[9],*N_CH[9];
+	int a,f,active = 0,numfb = 0,numplain = 0,off;
+
+	if( OPL->rythm&0x20 )
+	{
+		/* the rhythm block mixes its slots , render it */
+		OPLSAMPLE scratch[256];
+
+		while( length > 0 )
+		{
+			int n = length < 256 ? length : 256;
+			YM3812UpdateOne(OPL,scratch,n);
+			length -= n;
+		}
+		return;
+	}
+
+	for( a = 0 ; a < 9 ; a++ )
+	{
+		OPL_CH *CH = &OPL->P_CH[a];
+
+		if( OPL_CH_IDLE(CH) ) continue;
+		A_CH[active++] = CH;
+		if( CH->FB && !OPL_SLOT_IDLE(&CH->SLOT[SLOT1]) ) F_CH[numfb++] = CH;
+		else N_CH[numplain++] = CH;
+	}
+
+	/* SLOT 1 */
+#if OPL_SIMD_AVX2
+	if( numfb >= OPL_AVX2_MIN_FB && OPL_HaveAVX2() )
+	{
+		OPL_SKIP_FB_AVX2(OPL,F_CH,numfb,length);
+		numfb = 0;
+	}
+#endif
+	for( f = 0 ; f < numfb ; f++ )
+		OPL_SKIP_FB(OPL,F_CH[f],amsCnt,vibCnt,length);
+	for( a = 0 ; a < numplain ; a++ )
+	{
+		OPL_CH *CH = N_CH[a];
+
+		/* without feedback only silent samples touch the history */
+		off = length - OPL_SKIP_SLOT(OPL,&CH->SLOT[SLOT1],amsCnt,vibCnt,length);
+		if( off >= 2 ) CH->op1_out[0] = CH->op1_out[1] = 0;
+		else if( off == 1 )
+		{
+			CH->op1_out[1] = CH->op1_out[0];
+			CH->op1_out[0] = 0;
+		}
+	}
+	/* SLOT 2 */
+	for( a = 0 ; a < active ; a++ )
+		OPL_SKIP_SLOT(OPL,&A_CH[a]->SLOT[SLOT2],amsCnt,vibCnt,length);
+
+	OPL->amsCnt = amsCnt + OPL->amsIncr*length;
+	OPL->vibCnt = vibCnt + OPL->vibIncr*length;
+	OPL->sample_time += length;
+}
+
+/* ----------  update with queued register writes ---------- */
+/* Writes queued with OPLQueueWrite are applied in front of the sample */
+/* at their time stamp , writes already due go in at the first sample. */
+/* Writes past the end of the buffer stay queued for later calls.      */
+/* A NULL buffer advances the chip with YM3812SkipOne instead.         */
+void YM3812UpdateQueued(FM_OPL *OPL, INT16 *buffer, int length)
+{
+	int pos = 0,next;
+
+	/* length 0 applies the writes already due */
+	do
+	{
+		next = length;
+		/* apply the writes that are due */
+		while( OPL->queue_head < OPL->queue_tail )
+		{
+			OPL_EVENT *ev = &OPL->queue[OPL->queue_head];
+			INT32 due = (INT32)(ev->time - OPL->sample_time);
+
+			if( due > 0 )
+			{
+				if( due < length-pos ) next = pos+due;
+				break;
+			}
+			OPLWriteReg(OPL,ev->r,ev->v);
+			OPL->queue_head++;
+		}
+		/* render up to the next write */
+		if( buffer ) YM3812UpdateOne(OPL,buffer+pos,next-pos);
+		else         YM3812SkipOne(OPL,next-pos);
+		pos = next;
+	} while( pos < length );
+	if( OPL->queue_head == OPL->queue_tail )
+		OPL->queue_head = OPL->queue_tail = 0;
+}
 #endif /* (BUILD_YM3812 || BUILD_YM3526) */
 
 #if BUILD_Y8950
@@ -1113,53 +1732,44 @@ void Y8950UpdateOne(FM_OPL *OPL, INT16 *buffer, int length)
 	OPLSAMPLE *buf = buffer;
 	UINT32 amsCnt  = OPL->amsCnt;
 	UINT32 vibCnt  = OPL->vibCnt;
+	UINT32 amsIncr = OPL->amsIncr;
+	UINT32 vibIncr = OPL->vibIncr;
+	const INT32 *ams_table = OPL->ams_table;
+	const INT32 *vib_table = OPL->vib_table;
 	UINT8 rythm = OPL->rythm&0x20;
+	OPL_CH *S_CH = OPL->P_CH;
+	OPL_CH *E_CH = &S_CH[9];
 	OPL_CH *CH,*R_CH;
 	YM_DELTAT *DELTAT = OPL->deltat;
 
 	/* setup DELTA-T unit */
 	YM_DELTAT_DECODE_PRESET(DELTAT);
 
-	if( (void *)OPL != cur_chip ){
-		cur_chip = (void *)OPL;
-		/* channel pointers */
-		S_CH = OPL->P_CH;
-		E_CH = &S_CH[9];
-		/* rythm slot */
-		SLOT7_1 = &S_CH[7].SLOT[SLOT1];
-		SLOT7_2 = &S_CH[7].SLOT[SLOT2];
-		SLOT8_1 = &S_CH[8].SLOT[SLOT1];
-		SLOT8_2 = &S_CH[8].SLOT[SLOT2];
-		/* LFO state */
-		amsIncr = OPL->amsIncr;
-		vibIncr = OPL->vibIncr;
-		ams_table = OPL->ams_table;
-		vib_table = OPL->vib_table;
-	}
 	R_CH = rythm ? &S_CH[6] : E_CH;
     for( i=0; i < length ; i++ )
 	{
 		/*            channel A         channel B         channel C      */
 		/* LFO */
-		ams = ams_table[(amsCnt+=amsIncr)>>AMS_SHIFT];
-		vib = vib_table[(vibCnt+=vibIncr)>>VIB_SHIFT];
-		outd[0] = 0;
+		OPL->ams = ams_table[(amsCnt+=amsIncr)>>AMS_SHIFT];
+		OPL->vib = vib_table[(vibCnt+=vibIncr)>>VIB_SHIFT];
+		OPL->outd[0] = 0;
 		/* deltaT ADPCM */
 		if( DELTAT->portstate )
 			YM_DELTAT_ADPCM_CALC(DELTAT);
 		/* FM part */
 		for(CH=S_CH ; CH < R_CH ; CH++)
-			OPL_CALC_CH(CH);
+			OPL_CALC_CH(OPL,CH);
 		/* Rythn part */
 		if(rythm)
-			OPL_CALC_RH(S_CH);
+			OPL_CALC_RH(OPL,S_CH);
 		/* limit check */
-		data = Limit( outd[0] , OPL_MAXOUT, OPL_MINOUT );
+		data = Limit( OPL->outd[0] , OPL_MAXOUT, OPL_MINOUT );
 		/* store to sound buffer */
 		buf[i] = data >> OPL_OUTSB;
 	}
 	OPL->amsCnt = amsCnt;
 	OPL->vibCnt = vibCnt;
+	OPL->sample_time += length;
 	/* deltaT START flag */
 	if( !DELTAT->portstate )
 		OPL->status &= 0xfe;
@@ -1174,6 +1784,9 @@ void OPLResetChip(FM_OPL *OPL)
 
 	/* reset chip */
 	OPL->mode   = 0;	/* normal mode */
+	OPL->noise_rng = 1;	/* noise generator seed */
+	OPL->sample_time = 0;
+	OPL->queue_head = OPL->queue_tail = 0;	/* drop pending writes */
 	OPL_STATUS_RESET(OPL,0x7f);
 	/* reset with register write */
 	OPLWriteReg(OPL,0x01,0); /* wabesel disable */
@@ -1202,7 +1815,7 @@ void OPLResetChip(FM_OPL *OPL)
 		YM_DELTAT *DELTAT = OPL->deltat;
 
 		DELTAT->freqbase = OPL->freqbase;
-		DELTAT->output_pointer = outd;
+		DELTAT->output_pointer = OPL->outd;
 		DELTAT->portshift = 5;
 		DELTAT->output_range = DELTAT_MIXING_LEVEL<<TL_BITS;
 		YM_DELTAT_ADPCM_Reset(DELTAT,0);
@@ -1219,7 +1832,6 @@ FM_OPL *OPLCreate(int type, int clock, int rate)
 	int state_size;
 	int max_ch = 9; /* normaly 9 channels */
 
-	if( OPL_LockTable() ==-1) return NULL;
 	/* allocate OPL state space */
 	state_size  = sizeof(FM_OPL);
 	state_size += sizeof(OPL_CH)*max_ch;
@@ -1242,7 +1854,11 @@ FM_OPL *OPLCreate(int type, int clock, int rate)
 	OPL->rate  = rate;
 	OPL->max_ch = max_ch;
 	/* init grobal tables */
-	OPL_initalize(OPL);
+	if( OPL_initalize(OPL) < 0 )
+	{
+		free(OPL);
+		return NULL;
+	}
 	/* reset chip */
 	OPLResetChip(OPL);
 #ifdef OPL_OUTPUT_LOG
@@ -1280,7 +1896,8 @@ void OPLDestroy(FM_OPL *OPL)
 		opl_dbg_fp = NULL;
 	}
 #endif
-	OPL_UnLockTable();
+	OPL_UnLockRate(OPL->tables);
+	free(OPL->queue);
 	free(OPL);
 }
 
@@ -1339,6 +1956,203 @@ int OPLWrite(FM_OPL *OPL,int a,int v)
 	return OPL->status>>7;
 }
 
+/* ---------- queue a timestamped register write ---------- */
+/* 'time' is on the sample clock of OPLGetTime ; writes may be queued  */
+/* out of order , writes with the same time keep their order.          */
+/* return : 0 = queued , -1 = out of memory                            */
+int OPLQueueWrite(FM_OPL *OPL,UINT32 time,int r,int v)
+{
+	OPL_EVENT *ev;
+	int i;
+
+	if( OPL->queue_tail == OPL->queue_size )
+	{
+		if( OPL->queue_head > 0 )
+		{
+			/* reclaim the consumed entries */
+			memmove(OPL->queue,&OPL->queue[OPL->queue_head],
+				(OPL->queue_tail-OPL->queue_head)*sizeof(OPL_EVENT));
+			OPL->queue_tail -= OPL->queue_head;
+			OPL->queue_head = 0;
+		}
+		else
+		{
+			int size = OPL->queue_size ? OPL->queue_size*2 : 256;
+			ev = realloc(OPL->queue,size*sizeof(OPL_EVENT));
+			if( ev == NULL ) return -1;
+			OPL->queue = ev;
+			OPL->queue_size = size;
+		}
+	}
+	/* insert sorted by time */
+	for( i = OPL->queue_tail ; i > OPL->queue_head ; i-- )
+	{
+		if( (INT32)(OPL->queue[i-1].time - time) <= 0 ) break;
+		OPL->queue[i] = OPL->queue[i-1];
+	}
+	ev = &OPL->queue[i];
+	ev->time = time;
+	ev->r = r;
+	ev->v = v;
+	OPL->queue_tail++;
+	return 0;
+}
+
+/* ---------- sample clock : samples rendered since reset ---------- */
+UINT32 OPLGetTime(FM_OPL *OPL)
+{
+	return OPL->sample_time;
+}
+
+/* ---------- save chip state ---------- */
+void OPLSaveState(FM_OPL *OPL,OPL_STATE *state)
+{
+	int c,s;
+
+	memset(state,0,sizeof(OPL_STATE));
+	state->clock = OPL->clock;
+	state->rate  = OPL->rate;
+	state->mode  = OPL->mode;
+	state->noise_rng   = OPL->noise_rng;
+	state->sample_time = OPL->sample_time;
+	state->T[0]  = OPL->T[0];
+	state->T[1]  = OPL->T[1];
+	state->amsCnt = OPL->amsCnt;
+	state->vibCnt = OPL->vibCnt;
+	state->type    = OPL->type;
+	state->address = OPL->address;
+	state->status  = OPL->status;
+	state->statusmask = OPL->statusmask;
+	state->st[0] = OPL->st[0];
+	state->st[1] = OPL->st[1];
+	state->rythm   = OPL->rythm;
+	state->wavesel = OPL->wavesel;
+	state->portDirection = OPL->portDirection;
+	state->portLatch     = OPL->portLatch;
+	state->ams_depth = OPL->ams_table != AMS_TABLE;
+	state->vib_depth = OPL->vib_table != VIB_TABLE;
+	for( c = 0 ; c < OPL->max_ch ; c++ )
+	{
+		OPL_CH *CH = &OPL->P_CH[c];
+		OPL_CH_STATE *CS = &state->CH[c];
+
+		for( s = 0 ; s < 2 ; s++ )
+		{
+			OPL_SLOT *SLOT = &CH->SLOT[s];
+			OPL_SLOT_STATE *SS = &CS->SLOT[s];
+
+			SS->TL  = SLOT->TL;
+			SS->TLL = SLOT->TLL;
+			SS->SL  = SLOT->SL;
+			SS->mul = SLOT->mul;
+			SS->Cnt = SLOT->Cnt;
+			SS->Incr = SLOT->Incr;
+			SS->evc = SLOT->evc;
+			SS->eve = SLOT->eve;
+			SS->evs = SLOT->evs;
+			SS->evsa = SLOT->evsa;
+			SS->evsd = SLOT->evsd;
+			SS->evsr = SLOT->evsr;
+			SS->KSR = SLOT->KSR;
+			SS->ksl = SLOT->ksl;
+			SS->ksr = SLOT->ksr;
+			SS->eg_typ = SLOT->eg_typ;
+			SS->evm = SLOT->evm;
+			SS->ams = SLOT->ams;
+			SS->vib = SLOT->vib;
+			SS->ar = SLOT->AR == RATE_0 ? 0 : (SLOT->AR - OPL->tables->AR_TABLE)>>2;
+			SS->dr = SLOT->DR == RATE_0 ? 0 : (SLOT->DR - OPL->tables->DR_TABLE)>>2;
+			SS->rr = (SLOT->RR - OPL->tables->DR_TABLE)>>2;
+			SS->wave = (SLOT->wavetable - SIN_TABLE)/SIN_ENT;
+		}
+		CS->op1_out[0] = CH->op1_out[0];
+		CS->op1_out[1] = CH->op1_out[1];
+		CS->block_fnum = CH->block_fnum;
+		CS->fc = CH->fc;
+		CS->ksl_base = CH->ksl_base;
+		CS->CON = CH->CON;
+		CS->FB  = CH->FB;
+		CS->kcode = CH->kcode;
+		CS->keyon = CH->keyon;
+	}
+}
+
+/* ---------- load chip state ---------- */
+/* pending queued writes are dropped                     */
+/* return : 0 = loaded , -1 = saved from another kind of chip */
+int OPLLoadState(FM_OPL *OPL,const OPL_STATE *state)
+{
+	int c,s;
+
+	if( state->type != OPL->type || state->clock != OPL->clock || state->rate != OPL->rate )
+		return -1;
+	OPL->mode  = state->mode;
+	OPL->noise_rng   = state->noise_rng;
+	OPL->sample_time = state->sample_time;
+	OPL->queue_head = OPL->queue_tail = 0;
+	OPL->T[0]  = state->T[0];
+	OPL->T[1]  = state->T[1];
+	OPL->amsCnt = state->amsCnt;
+	OPL->vibCnt = state->vibCnt;
+	OPL->address = state->address;
+	OPL->status  = state->status;
+	OPL->statusmask = state->statusmask;
+	OPL->st[0] = state->st[0];
+	OPL->st[1] = state->st[1];
+	OPL->rythm   = state->rythm;
+	OPL->wavesel = state->wavesel;
+	OPL->portDirection = state->portDirection;
+	OPL->portLatch     = state->portLatch;
+	OPL->ams_table = &AMS_TABLE[state->ams_depth ? AMS_ENT : 0];
+	OPL->vib_table = &VIB_TABLE[state->vib_depth ? VIB_ENT : 0];
+	for( c = 0 ; c < OPL->max_ch ; c++ )
+	{
+		OPL_CH *CH = &OPL->P_CH[c];
+		const OPL_CH_STATE *CS = &state->CH[c];
+
+		for( s = 0 ; s < 2 ; s++ )
+		{
+			OPL_SLOT *SLOT = &CH->SLOT[s];
+			const OPL_SLOT_STATE *SS = &CS->SLOT[s];
+
+			SLOT->TL  = SS->TL;
+			SLOT->TLL = SS->TLL;
+			SLOT->SL  = SS->SL;
+			SLOT->mul = SS->mul;
+			SLOT->Cnt = SS->Cnt;
+			SLOT->Incr = SS->Incr;
+			SLOT->evc = SS->evc;
+			SLOT->eve = SS->eve;
+			SLOT->evs = SS->evs;
+			SLOT->evsa = SS->evsa;
+			SLOT->evsd = SS->evsd;
+			SLOT->evsr = SS->evsr;
+			SLOT->KSR = SS->KSR;
+			SLOT->ksl = SS->ksl;
+			SLOT->ksr = SS->ksr;
+			SLOT->eg_typ = SS->eg_typ;
+			SLOT->evm = SS->evm;
+			SLOT->ams = SS->ams;
+			SLOT->vib = SS->vib;
+			SLOT->AR = SS->ar ? &OPL->tables->AR_TABLE[(SS->ar&15)<<2] : RATE_0;
+			SLOT->DR = SS->dr ? &OPL->tables->DR_TABLE[(SS->dr&15)<<2] : RATE_0;
+			SLOT->RR = &OPL->tables->DR_TABLE[(SS->rr&15)<<2];
+			SLOT->wavetable = &SIN_TABLE[(SS->wave&3)*SIN_ENT];
+		}
+		CH->op1_out[0] = CS->op1_out[0];
+		CH->op1_out[1] = CS->op1_out[1];
+		CH->block_fnum = CS->block_fnum;
+		CH->fc = CS->fc;
+		CH->ksl_base = CS->ksl_base;
+		CH->CON = CS->CON;
+		CH->FB  = CS->FB;
+		CH->kcode = CS->kcode;
+		CH->keyon = CS->keyon;
+		set_algorythm(OPL,CH);
+	}
+	return 0;
+}
+
 unsigned char OPLRead(FM_OPL *OPL,int a)
 {
 	if( !(a&1) )
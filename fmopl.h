@@ -6,9 +6,17 @@
 //#define BUILD_YM3526 (HAS_YM3526)
 //#define BUILD_Y8950  (HAS_Y8950)
 
+/* bump when the synthesized output changes, caches of rendered  */
+/* levels (pisplay .pisc files) check it                         */
+#define FMOPL_REVISION 1
+
 /* --- system optimize --- */
 /* select bit size of output : 8 or 16 */
 #define OPL_OUTPUT_BIT 16
+/* use the AVX2 channel kernel when the CPU supports it : 0 or 1 */
+#ifndef OPL_USE_SIMD
+#define OPL_USE_SIMD 1
+#endif
 
 /* compiler dependence */
 #ifndef OSD_CPU_H
@@ -52,10 +60,10 @@ typedef struct fm_opl_slot {
 	INT32 TL;		/* total level     :TL << 8            */
 	INT32 TLL;		/* adjusted now TL                     */
 	UINT8  KSR;		/* key scale rate  :(shift down bit)   */
-	INT32 *AR;		/* attack rate     :&AR_TABLE[AR<<2]   */
-	INT32 *DR;		/* decay rate      :&DR_TALBE[DR<<2]   */
+	const INT32 *AR;	/* attack rate     :&AR_TABLE[AR<<2]   */
+	const INT32 *DR;	/* decay rate      :&DR_TALBE[DR<<2]   */
 	INT32 SL;		/* sustin level    :SL_TALBE[SL]       */
-	INT32 *RR;		/* release rate    :&DR_TABLE[RR<<2]   */
+	const INT32 *RR;	/* release rate    :&DR_TABLE[RR<<2]   */
 	UINT8 ksl;		/* keyscale level  :(shift down bits)  */
 	UINT8 ksr;		/* key scale rate  :kcode>>KSR         */
 	UINT32 mul;		/* multiple        :ML_TABLE[ML]       */
@@ -74,7 +82,7 @@ typedef struct fm_opl_slot {
 	UINT8 ams;		/* ams flag                            */
 	UINT8 vib;		/* vibrate flag                        */
 	/* wave selector */
-	INT32 **wavetable;
+	const UINT16 *wavetable;
 }OPL_SLOT;
 
 /* ---------- OPL one of channel  ---------- */
@@ -93,6 +101,55 @@ typedef struct fm_opl_channel {
 	UINT8 keyon;		/* key on/off flag                     */
 } OPL_CH;
 
+/* ---------- clock / rate dependent tables ---------- */
+/* shared read-only by every chip created with the same clock and rate */
+typedef struct fm_opl_rate {
+	struct fm_opl_rate *next;	/* next entry of the table cache */
+	int clock;					/* master clock  (Hz)            */
+	int rate;					/* sampling rate (Hz)            */
+	int refcount;				/* chips using these tables      */
+	INT32 AR_TABLE[75];			/* atttack rate tables           */
+	INT32 DR_TABLE[75];			/* decay rate tables             */
+	UINT32 FN_TABLE[1024];		/* fnumber -> increment counter  */
+} OPL_RATE;
+
+/* ---------- timestamped register write ---------- */
+typedef struct fm_opl_event {
+	UINT32 time;		/* sample clock of the write           */
+	UINT8 r;			/* register                            */
+	UINT8 v;			/* data                                */
+} OPL_EVENT;
+
+/* ---------- saved chip state ---------- */
+/* position independent : table pointers are kept as table indexes */
+/* YM3526 / YM3812 only , the Y8950 ADPCM unit is not included       */
+typedef struct fm_opl_slot_state {
+	INT32 TL,TLL,SL;
+	UINT32 mul,Cnt,Incr;
+	INT32 evc,eve,evs,evsa,evsd,evsr;
+	UINT8 KSR,ksl,ksr,eg_typ,evm,ams,vib;
+	UINT8 ar,dr,rr;		/* rate of AR/DR/RR , ar/dr 0 = RATE_0 */
+	UINT8 wave;			/* waveform of wavetable               */
+} OPL_SLOT_STATE;
+
+typedef struct fm_opl_channel_state {
+	OPL_SLOT_STATE SLOT[2];
+	INT32 op1_out[2];
+	UINT32 block_fnum,fc,ksl_base;
+	UINT8 CON,FB,kcode,keyon;
+} OPL_CH_STATE;
+
+typedef struct fm_opl_state {
+	INT32 clock,rate;	/* must match the chip it is loaded to */
+	UINT32 mode,noise_rng,sample_time;
+	INT32 T[2];
+	INT32 amsCnt,vibCnt;
+	UINT8 type,address,status,statusmask,st[2];
+	UINT8 rythm,wavesel,portDirection,portLatch;
+	UINT8 ams_depth,vib_depth;	/* AMS_TABLE / VIB_TABLE half in use */
+	OPL_CH_STATE CH[9];
+} OPL_STATE;
+
 /* OPL state */
 typedef struct fm_opl_f {
 	UINT8 type;			/* chip type                         */
@@ -112,6 +169,7 @@ typedef struct fm_opl_f {
 	int	max_ch;			/* maximum channel                   */
 	/* Rythm sention */
 	UINT8 rythm;		/* Rythm mode , key flag */
+	UINT32 noise_rng;	/* white noise LFSR                  */
 #if BUILD_Y8950
 	/* Delta-T ADPCM unit (Y8950) */
 	YM_DELTAT *deltat;			/* DELTA-T ADPCM       */
@@ -126,18 +184,27 @@ typedef struct fm_opl_f {
 	OPL_PORTHANDLER_W keyboardhandler_w;
 	int keyboard_param;
 	/* time tables */
-	INT32 AR_TABLE[75];	/* atttack rate tables */
-	INT32 DR_TABLE[75];	/* decay rate tables   */
-	UINT32 FN_TABLE[1024];  /* fnumber -> increment counter */
+	const OPL_RATE *tables;	/* shared AR / DR / FN tables */
 	/* LFO */
-	INT32 *ams_table;
-	INT32 *vib_table;
+	const INT32 *ams_table;
+	const INT32 *vib_table;
 	INT32 amsCnt;
 	INT32 amsIncr;
 	INT32 vibCnt;
 	INT32 vibIncr;
+	/* render work area (valid during YMxxxxUpdateOne only) */
+	INT32 outd[1];		/* mixing output                     */
+	INT32 ams;			/* current AMS level                 */
+	INT32 vib;			/* current VIB rate                  */
+	INT32 feedback2;	/* connect for SLOT 2                */
 	/* wave selector enable flag */
 	UINT8 wavesel;
+	/* sample clock and queued register writes */
+	UINT32 sample_time;	/* samples rendered since reset      */
+	OPL_EVENT *queue;	/* pending writes , sorted by time   */
+	int queue_head;		/* first pending write               */
+	int queue_tail;		/* end of pending writes             */
+	int queue_size;		/* allocated entries                 */
 	/* external event callback handler */
 	OPL_TIMERHANDLER  TimerHandler;		/* TIMER handler   */
 	int TimerParam;						/* TIMER parameter */
@@ -165,9 +232,22 @@ void OPLResetChip(FM_OPL *OPL);
 int OPLWrite(FM_OPL *OPL,int a,int v);
 unsigned char OPLRead(FM_OPL *OPL,int a);
 int OPLTimerOver(FM_OPL *OPL,int c);
+/* timestamped writes , applied by YM3812UpdateQueued at sample 'time' */
+int OPLQueueWrite(FM_OPL *OPL,UINT32 time,int r,int v);
+UINT32 OPLGetTime(FM_OPL *OPL);
+/* complete chip state , without the queued writes */
+void OPLSaveState(FM_OPL *OPL,OPL_STATE *state);
+int OPLLoadState(FM_OPL *OPL,const OPL_STATE *state);
 
 /* YM3626/YM3812 local section */
 void YM3812UpdateOne(FM_OPL *OPL, INT16 *buffer, int length);
+/* render several independent chips in lockstep , one per vector lane */
+#define OPL_BANK_LANES 8
+void YM3812UpdateBank(FM_OPL **chip, INT16 **buffer, int num, int length);
+/* advance to the state of YM3812UpdateOne without rendering the output */
+void YM3812SkipOne(FM_OPL *OPL, int length);
+/* render with the queued writes applied at their exact sample position */
+void YM3812UpdateQueued(FM_OPL *OPL, INT16 *buffer, int length);
 
 void Y8950UpdateOne(FM_OPL *OPL, INT16 *buffer, int length);
 
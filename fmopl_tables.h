@@ -0,0 +1,3227 @@
+/* fmopl_tables.h -- constant tables for fmopl.c */
+/* generated by mkopltab.c, do not edit           */
+
+#if (SIN_ENT != 2048) || (EG_ENT != 4096) || (ENV_BITS != 16) || (TL_BITS != 26)
+#error "fmopl_tables.h does not match the quality selection, rerun mkopltab"
+#endif
+#if (AMS_ENT != 512) || (VIB_ENT != 512) || (VIB_RATE != 256) || (TL_MAX != 8192)
+#error "fmopl_tables.h does not match the LFO/layout selection, rerun mkopltab"
+#endif
+
+static const INT32 TL_TABLE[TL_MAX*2] = {
+	67108863, 66928024, 66747673, 66567807, 66388427, 66209530, 66031114, 65853180,
+	65675725, 65498749, 65322249, 65146225, 64970675, 64795598, 64620993, 64446859,
+	64273193, 64099996, 63927265, 63755000, 63583199, 63411861, 63240985, 63070569,
+	62900613, 62731114, 62562073, 62393486, 62225354, 62057675, 61890448, 61723672,
+	61557345, 61391466, 61226034, 61061048, 60896506, 60732408, 60568752, 60405537,
+	60242762, 60080426, 59918527, 59757064, 59596036, 59435443, 59275282, 59115552,
+	58956253, 58797384, 58638942, 58480928, 58323339, 58166175, 58009434, 57853116,
+	57697219, 57541742, 57386684, 57232043, 57077820, 56924012, 56770619, 56617639,
+	56465071, 56312914, 56161167, 56009830, 55858900, 55708376, 55558259, 55408546,
+	55259236, 55110329, 54961823, 54813717, 54666010, 54518701, 54371789, 54225274,
+	54079152, 53933425, 53788090, 53643147, 53498595, 53354432, 53210658, 53067271,
+	52924270, 52781655, 52639424, 52497576, 52356111, 52215026, 52074322, 51933997,
+	51794051, 51654481, 51515287, 51376469, 51238024, 51099953, 50962254, 50824926,
+	50687967, 50551378, 50415157, 50279303, 50143815, 50008693, 49873934, 49739539,
+	49605505, 49471833, 49338521, 49205568, 49072974, 48940737, 48808856, 48677330,
+	48546159, 48415342, 48284877, 48154763, 48025000, 47895587, 47766523, 47637806,
+	47509436, 47381412, 47253733, 47126398, 46999407, 46872757, 46746449, 46620481,
+	46494853, 46369563, 46244611, 46119995, 45995715, 45871770, 45748159, 45624882,
+	45501936, 45379322, 45257038, 45135084, 45013458, 44892160, 44771189, 44650544,
+	44530224, 44410228, 44290555, 44171205, 44052177, 43933469, 43815082, 43697013,
+	43579262, 43461829, 43344712, 43227911, 43111425, 42995252, 42879393, 42763845,
+	42648609, 42533684, 42419068, 42304761, 42190763, 42077071, 41963686, 41850606,
+	41737831, 41625360, 41513192, 41401326, 41289762, 41178498, 41067534, 40956869,
+	40846502, 40736433, 40626661, 40517184, 40408002, 40299114, 40190520, 40082218,
+	39974209, 39866490, 39759062, 39651923, 39545072, 39438510, 39332235, 39226246,
+	39120543, 39015125, 38909991, 38805140, 38700571, 38596285, 38492279, 38388554,
+	38285108, 38181941, 38079052, 37976440, 37874105, 37772045, 37670261, 37568750,
+	37467514, 37366550, 37265858, 37165438, 37065288, 36965408, 36865797, 36766454,
+	36667380, 36568572, 36470030, 36371754, 36273743, 36175996, 36078513, 35981292,
+	35884333, 35787635, 35691198, 35595021, 35499103, 35403443, 35308041, 35212896,
+	35118008, 35023375, 34928998, 34834874, 34741005, 34647388, 34554024, 34460911,
+	34368049, 34275437, 34183075, 34090961, 33999096, 33907479, 33816108, 33724984,
+	33634105, 33543471, 33453081, 33362935, 33273032, 33183371, 33093951, 33004773,
+	32915835, 32827136, 32738677, 32650456, 32562473, 32474726, 32387216, 32299942,
+	32212904, 32126099, 32039529, 31953192, 31867088, 31781215, 31695574, 31610164,
+	31524984, 31440033, 31355312, 31270818, 31186553, 31102514, 31018702, 30935116,
+	30851755, 30768619, 30685706, 30603017, 30520551, 30438307, 30356285, 30274484,
+	30192903, 30111542, 30030400, 29949477, 29868772, 29788285, 29708014, 29627960,
+	29548121, 29468498, 29389089, 29309894, 29230913, 29152144, 29073587, 28995243,
+	28917109, 28839186, 28761473, 28683969, 28606674, 28529588, 28452709, 28376037,
+	28299572, 28223313, 28147260, 28071411, 27995767, 27920327, 27845090, 27770056,
+	27695223, 27620593, 27546164, 27471935, 27397906, 27324077, 27250447, 27177015,
+	27103781, 27030744, 26957904, 26885260, 26812813, 26740560, 26668502, 26596638,
+	26524968, 26453491, 26382207, 26311115, 26240214, 26169504, 26098985, 26028656,
+	25958517, 25888566, 25818804, 25749230, 25679843, 25610644, 25541631, 25472804,
+	25404162, 25335705, 25267433, 25199345, 25131440, 25063718, 24996179, 24928821,
+	24861646, 24794651, 24727837, 24661202, 24594748, 24528472, 24462375, 24396456,
+	24330715, 24265151, 24199764, 24134552, 24069517, 24004657, 23939971, 23875460,
+	23811123, 23746959, 23682968, 23619149, 23555502, 23492027, 23428723, 23365590,
+	23302626, 23239833, 23177208, 23114752, 23052465, 22990345, 22928393, 22866608,
+	22804989, 22743537, 22682249, 22621127, 22560170, 22499377, 22438748, 22378282,
+	22317979, 22257839, 22197861, 22138044, 22078388, 22018894, 21959559, 21900385,
+	21841370, 21782514, 21723816, 21665277, 21606895, 21548671, 21490604, 21432693,
+	21374938, 21317339, 21259895, 21202606, 21145471, 21088491, 21031663, 20974989,
+	20918468, 20862099, 20805881, 20749816, 20693901, 20638137, 20582524, 20527060,
+	20471745, 20416580, 20361563, 20306695, 20251974, 20197401, 20142975, 20088696,
+	20034563, 19980576, 19926734, 19873037, 19819485, 19766078, 19712814, 19659694,
+	19606717, 19553882, 19501190, 19448640, 19396232, 19343965, 19291839, 19239853,
+	19188007, 19136301, 19084734, 19033307, 18982017, 18930867, 18879853, 18828978,
+	18778239, 18727637, 18677172, 18626843, 18576649, 18526590, 18476666, 18426877,
+	18377222, 18327701, 18278313, 18229059, 18179937, 18130947, 18082090, 18033364,
+	17984769, 17936306, 17887973, 17839770, 17791697, 17743753, 17695939, 17648254,
+	17600697, 17553268, 17505968, 17458794, 17411748, 17364828, 17318035, 17271368,
+	17224827, 17178411, 17132120, 17085954, 17039913, 16993995, 16948201, 16902531,
+	16856984, 16811559, 16766257, 16721077, 16676018, 16631082, 16586266, 16541571,
+	16496996, 16452541, 16408207, 16363991, 16319895, 16275918, 16232059, 16188319,
+	16144696, 16101191, 16057803, 16014532, 15971377, 15928339, 15885417, 15842610,
+	15799919, 15757343, 15714882, 15672535, 15630302, 15588183, 15546177, 15504285,
+	15462505, 15420839, 15379284, 15337841, 15296510, 15255291, 15214182, 15173185,
+	15132297, 15091520, 15050853, 15010295, 14969847, 14929508, 14889277, 14849155,
+	14809141, 14769235, 14729436, 14689744, 14650160, 14610682, 14571311, 14532045,
+	14492886, 14453832, 14414883, 14376039, 14337300, 14298665, 14260134, 14221707,
+	14183384, 14145164, 14107047, 14069033, 14031121, 13993311, 13955603, 13917997,
+	13880492, 13843088, 13805785, 13768583, 13731481, 13694478, 13657576, 13620773,
+	13584069, 13547464, 13510957, 13474549, 13438239, 13402027, 13365913, 13329895,
+	13293975, 13258152, 13222425, 13186795, 13151260, 13115821, 13080478, 13045230,
+	13010077, 12975019, 12940055, 12905185, 12870409, 12835728, 12801139, 12766644,
+	12732241, 12697932, 12663715, 12629590, 12595557, 12561615, 12527765, 12494007,
+	12460339, 12426762, 12393276, 12359880, 12326573, 12293357, 12260230, 12227192,
+	12194244, 12161384, 12128612, 12095929, 12063334, 12030827, 11998408, 11966075,
+	11933830, 11901672, 11869601, 11837616, 11805717, 11773904, 11742177, 11710535,
+	11678979, 11647507, 11616121, 11584819, 11553601, 11522467, 11491418, 11460452,
+	11429569, 11398770, 11368054, 11337420, 11306869, 11276400, 11246014, 11215709,
+	11185486, 11155344, 11125284, 11095305, 11065406, 11035588, 11005851, 10976193,
+	10946615, 10917118, 10887699, 10858360, 10829100, 10799919, 10770816, 10741792,
+	10712846, 10683978, 10655188, 10626475, 10597840, 10569282, 10540801, 10512397,
+	10484069, 10455817, 10427642, 10399543, 10371519, 10343571, 10315698, 10287900,
+	10260177, 10232529, 10204955, 10177456, 10150031, 10122679, 10095402, 10068198,
+	10041067, 10014009, 9987024, 9960112, 9933273, 9906505, 9879810, 9853187,
+	9826636, 9800156, 9773747, 9747410, 9721144, 9694948, 9668823, 9642768,
+	9616784, 9590870, 9565025, 9539250, 9513545, 9487908, 9462341, 9436843,
+	9411414, 9386053, 9360760, 9335535, 9310379, 9285290, 9260269, 9235315,
+	9210429, 9185610, 9160857, 9136171, 9111552, 9086999, 9062512, 9038091,
+	9013736, 8989447, 8965223, 8941065, 8916971, 8892942, 8868979, 8845079,
+	8821244, 8797474, 8773767, 8750124, 8726545, 8703030, 8679578, 8656189,
+	8632863, 8609600, 8586400, 8563262, 8540187, 8517173, 8494222, 8471333,
+	8448505, 8425739, 8403034, 8380390, 8357807, 8335285, 8312824, 8290424,
+	8268084, 8245803, 8223583, 8201423, 8179323, 8157282, 8135301, 8113378,
+	8091515, 8069711, 8047965, 8026279, 8004650, 7983080, 7961568, 7940114,
+	7918718, 7897379, 7876098, 7854874, 7833708, 7812598, 7791545, 7770549,
+	7749610, 7728727, 7707901, 7687130, 7666415, 7645757, 7625154, 7604606,
+	7584114, 7563677, 7543295, 7522968, 7502696, 7482478, 7462315, 7442207,
+	7422152, 7402152, 7382205, 7362312, 7342473, 7322687, 7302955, 7283275,
+	7263649, 7244076, 7224555, 7205087, 7185671, 7166308, 7146997, 7127738,
+	7108531, 7089375, 7070272, 7051219, 7032218, 7013269, 6994370, 6975522,
+	6956725, 6937979, 6919283, 6900638, 6882042, 6863497, 6845002, 6826557,
+	6808161, 6789816, 6771519, 6753272, 6735074, 6716925, 6698824, 6680773,
+	6662770, 6644816, 6626910, 6609053, 6591243, 6573482, 6555768, 6538102,
+	6520484, 6502913, 6485390, 6467914, 6450485, 6433103, 6415767, 6398479,
+	6381237, 6364041, 6346892, 6329789, 6312732, 6295721, 6278756, 6261836,
+	6244963, 6228134, 6211351, 6194614, 6177921, 6161273, 6144670, 6128112,
+	6111599, 6095130, 6078705, 6062325, 6045989, 6029697, 6013448, 5997244,
+	5981083, 5964966, 5948892, 5932862, 5916874, 5900930, 5885029, 5869170,
+	5853355, 5837582, 5821851, 5806163, 5790517, 5774913, 5759352, 5743832,
+	5728354, 5712918, 5697523, 5682170, 5666858, 5651588, 5636358, 5621170,
+	5606023, 5590916, 5575850, 5560825, 5545840, 5530896, 5515992, 5501128,
+	5486304, 5471520, 5456776, 5442071, 5427406, 5412781, 5398195, 5383649,
+	5369141, 5354673, 5340244, 5325853, 5311502, 5297189, 5282915, 5268679,
+	5254481, 5240322, 5226201, 5212118, 5198073, 5184065, 5170096, 5156164,
+	5142270, 5128413, 5114593, 5100811, 5087066, 5073357, 5059686, 5046052,
+	5032454, 5018893, 5005369, 4991881, 4978429, 4965014, 4951635, 4938291,
+	4924984, 4911713, 4898477, 4885277, 4872113, 4858984, 4845890, 4832832,
+	4819809, 4806821, 4793868, 4780950, 4768067, 4755218, 4742404, 4729625,
+	4716880, 4704169, 4691493, 4678851, 4666243, 4653669, 4641128, 4628622,
+	4616149, 4603710, 4591304, 4578932, 4566593, 4554288, 4542015, 4529776,
+	4517569, 4505396, 4493255, 4481147, 4469072, 4457029, 4445019, 4433041,
+	4421095, 4409181, 4397300, 4385450, 4373633, 4361847, 4350093, 4338371,
+	4326681, 4315021, 4303394, 4291797, 4280232, 4268698, 4257195, 4245723,
+	4234282, 4222872, 4211493, 4200144, 4188826, 4177538, 4166281, 4155054,
+	4143858, 4132691, 4121555, 4110448, 4099372, 4088325, 4077309, 4066321,
+	4055364, 4044436, 4033537, 4022668, 4011828, 4001018, 3990236, 3979483,
+	3968760, 3958065, 3947399, 3936762, 3926154, 3915574, 3905023, 3894500,
+	3884005, 3873539, 3863101, 3852691, 3842309, 3831955, 3821629, 3811331,
+	3801061, 3790818, 3780603, 3770415, 3760255, 3750122, 3740017, 3729939,
+	3719888, 3709864, 3699867, 3689897, 3679953, 3670037, 3660147, 3650284,
+	3640448, 3630638, 3620854, 3611097, 3601367, 3591662, 3581983, 3572331,
+	3562705, 3553104, 3543530, 3533981, 3524458, 3514960, 3505489, 3496042,
+	3486622, 3477226, 3467856, 3458511, 3449192, 3439897, 3430628, 3421383,
+	3412163, 3402969, 3393799, 3384653, 3375533, 3366437, 3357365, 3348318,
+	3339295, 3330297, 3321323, 3312373, 3303447, 3294545, 3285667, 3276813,
+	3267983, 3259177, 3250394, 3241636, 3232900, 3224189, 3215500, 3206836,
+	3198194, 3189576, 3180981, 3172409, 3163860, 3155335, 3146832, 3138352,
+	3129895, 3121461, 3113050, 3104661, 3096295, 3087951, 3079630, 3071331,
+	3063055, 3054801, 3046569, 3038360, 3030172, 3022007, 3013863, 3005742,
+	2997642, 2989565, 2981509, 2973474, 2965462, 2957471, 2949501, 2941553,
+	2933626, 2925721, 2917837, 2909974, 2902133, 2894313, 2886513, 2878735,
+	2870978, 2863241, 2855526, 2847831, 2840157, 2832503, 2824871, 2817258,
+	2809667, 2802095, 2794545, 2787014, 2779504, 2772014, 2764544, 2757095,
+	2749665, 2742256, 2734866, 2727496, 2720147, 2712817, 2705506, 2698216,
+	2690945, 2683694, 2676462, 2669250, 2662057, 2654883, 2647729, 2640594,
+	2633479, 2626382, 2619305, 2612247, 2605207, 2598187, 2591186, 2584203,
+	2577240, 2570295, 2563369, 2556461, 2549572, 2542702, 2535850, 2529017,
+	2522202, 2515405, 2508627, 2501867, 2495125, 2488401, 2481696, 2475008,
+	2468339, 2461687, 2455054, 2448438, 2441840, 2435260, 2428698, 2422154,
+	2415627, 2409117, 2402625, 2396151, 2389694, 2383254, 2376832, 2370427,
+	2364040, 2357669, 2351316, 2344980, 2338661, 2332359, 2326074, 2319806,
+	2313555, 2307320, 2301103, 2294902, 2288718, 2282551, 2276400, 2270266,
+	2264148, 2258047, 2251962, 2245894, 2239841, 2233806, 2227786, 2221783,
+	2215796, 2209825, 2203870, 2197932, 2192009, 2186102, 2180211, 2174336,
+	2168477, 2162633, 2156806, 2150994, 2145197, 2139417, 2133652, 2127902,
+	2122168, 2116449, 2110746, 2105058, 2099386, 2093729, 2088087, 2082460,
+	2076848, 2071252, 2065670, 2060104, 2054553, 2049016, 2043495, 2037988,
+	2032496, 2027019, 2021557, 2016110, 2010677, 2005259, 1999855, 1994466,
+	1989092, 1983732, 1978386, 1973055, 1967738, 1962436, 1957147, 1951873,
+	1946614, 1941368, 1936137, 1930919, 1925716, 1920527, 1915352, 1910190,
+	1905043, 1899909, 1894790, 1889684, 1884592, 1879513, 1874449, 1869397,
+	1864360, 1859336, 1854326, 1849329, 1844345, 1839375, 1834419, 1829476,
+	1824546, 1819629, 1814726, 1809836, 1804959, 1800095, 1795244, 1790406,
+	1785582, 1780770, 1775972, 1771186, 1766413, 1761653, 1756906, 1752172,
+	1747450, 1742741, 1738045, 1733361, 1728691, 1724032, 1719386, 1714753,
+	1710132, 1705524, 1700928, 1696345, 1691774, 1687215, 1682668, 1678134,
+	1673612, 1669102, 1664604, 1660119, 1655645, 1651184, 1646734, 1642297,
+	1637871, 1633458, 1629056, 1624666, 1620288, 1615922, 1611567, 1607225,
+	1602894, 1598574, 1594267, 1589971, 1585686, 1581413, 1577152, 1572902,
+	1568663, 1564436, 1560221, 1556016, 1551823, 1547641, 1543471, 1539312,
+	1535164, 1531027, 1526901, 1522787, 1518683, 1514591, 1510510, 1506439,
+	1502380, 1498331, 1494294, 1490267, 1486251, 1482246, 1478252, 1474269,
+	1470296, 1466334, 1462383, 1458442, 1454512, 1450592, 1446683, 1442785,
+	1438897, 1435020, 1431153, 1427296, 1423450, 1419614, 1415789, 1411974,
+	1408169, 1404374, 1400590, 1396816, 1393052, 1389298, 1385554, 1381820,
+	1378097, 1374383, 1370680, 1366986, 1363302, 1359629, 1355965, 1352311,
+	1348667, 1345033, 1341408, 1337794, 1334189, 1330593, 1327008, 1323432,
+	1319866, 1316309, 1312762, 1309224, 1305696, 1302178, 1298669, 1295169,
+	1291679, 1288199, 1284727, 1281265, 1277813, 1274369, 1270935, 1267511,
+	1264095, 1260689, 1257291, 1253903, 1250525, 1247155, 1243794, 1240442,
+	1237100, 1233766, 1230441, 1227126, 1223819, 1220521, 1217232, 1213952,
+	1210681, 1207419, 1204165, 1200920, 1197684, 1194456, 1191238, 1188028,
+	1184826, 1181634, 1178449, 1175274, 1172107, 1168948, 1165798, 1162657,
+	1159524, 1156399, 1153283, 1150175, 1147076, 1143985, 1140902, 1137828,
+	1134762, 1131704, 1128654, 1125613, 1122580, 1119555, 1116538, 1113529,
+	1110528, 1107536, 1104551, 1101575, 1098607, 1095646, 1092694, 1089749,
+	1086813, 1083884, 1080963, 1078050, 1075145, 1072248, 1069359, 1066477,
+	1063603, 1060737, 1057879, 1055028, 1052185, 1049350, 1046522, 1043702,
+	1040890, 1038085, 1035287, 1032498, 1029715, 1026941, 1024173, 1021413,
+	1018661, 1015916, 1013178, 1010448, 1007725, 1005010, 1002302, 999601,
+	996907, 994221, 991542, 988870, 986205, 983547, 980897, 978254,
+	975618, 972989, 970367, 967752, 965144, 962543, 959950, 957363,
+	954783, 952210, 949644, 947085, 944533, 941988, 939449, 936918,
+	934393, 931875, 929364, 926860, 924362, 921871, 919387, 916910,
+	914439, 911975, 909517, 907066, 904622, 902184, 899753, 897329,
+	894911, 892499, 890094, 887695, 885303, 882918, 880539, 878166,
+	875799, 873439, 871086, 868738, 866397, 864063, 861734, 859412,
+	857096, 854787, 852483, 850186, 847895, 845610, 843332, 841059,
+	838793, 836532, 834278, 832030, 829788, 827552, 825322, 823098,
+	820880, 818668, 816462, 814262, 812067, 809879, 807697, 805520,
+	803350, 801185, 799026, 796873, 794725, 792584, 790448, 788318,
+	786194, 784075, 781962, 779855, 777754, 775658, 773568, 771483,
+	769404, 767331, 765263, 763201, 761144, 759093, 757048, 755008,
+	752973, 750944, 748921, 746903, 744890, 742883, 740881, 738884,
+	736893, 734908, 732927, 730952, 728982, 727018, 725059, 723105,
+	721157, 719213, 717275, 715342, 713415, 711492, 709575, 707663,
+	705756, 703854, 701958, 700066, 698179, 696298, 694422, 692550,
+	690684, 688823, 686967, 685116, 683270, 681428, 679592, 677761,
+	675934, 674113, 672296, 670485, 668678, 666876, 665079, 663287,
+	661500, 659717, 657939, 656166, 654398, 652635, 650876, 649122,
+	647373, 645628, 643889, 642154, 640423, 638697, 636976, 635260,
+	633548, 631841, 630138, 628440, 626747, 625058, 623373, 621694,
+	620018, 618348, 616681, 615020, 613362, 611709, 610061, 608417,
+	606778, 605142, 603512, 601886, 600264, 598646, 597033, 595424,
+	593820, 592219, 590624, 589032, 587445, 585862, 584283, 582709,
+	581138, 579572, 578011, 576453, 574900, 573350, 571805, 570265,
+	568728, 567195, 565667, 564143, 562622, 561106, 559594, 558086,
+	556582, 555083, 553587, 552095, 550607, 549124, 547644, 546168,
+	544696, 543229, 541765, 540305, 538849, 537397, 535949, 534504,
+	533064, 531628, 530195, 528766, 527342, 525920, 524503, 523090,
+	521680, 520275, 518873, 517474, 516080, 514689, 513302, 511919,
+	510540, 509164, 507792, 506423, 505059, 503698, 502341, 500987,
+	499637, 498290, 496948, 495609, 494273, 492941, 491613, 490288,
+	488967, 487649, 486335, 485025, 483718, 482414, 481114, 479818,
+	478525, 477235, 475949, 474667, 473388, 472112, 470840, 469571,
+	468306, 467044, 465785, 464530, 463278, 462030, 460785, 459543,
+	458305, 457070, 455838, 454610, 453385, 452163, 450945, 449729,
+	448518, 447309, 446104, 444901, 443703, 442507, 441314, 440125,
+	438939, 437756, 436577, 435400, 434227, 433057, 431890, 430726,
+	429565, 428408, 427253, 426102, 424954, 423809, 422667, 421528,
+	420392, 419259, 418129, 417003, 415879, 414758, 413641, 412526,
+	411414, 410306, 409200, 408097, 406998, 405901, 404807, 403716,
+	402628, 401543, 400461, 399382, 398306, 397233, 396162, 395095,
+	394030, 392968, 391909, 390853, 389800, 388750, 387702, 386657,
+	385615, 384576, 383540, 382506, 381476, 380448, 379422, 378400,
+	377380, 376363, 375349, 374338, 373329, 372323, 371320, 370319,
+	369321, 368326, 367334, 366344, 365356, 364372, 363390, 362411,
+	361434, 360460, 359489, 358520, 357554, 356591, 355630, 354671,
+	353716, 352762, 351812, 350864, 349918, 348975, 348035, 347097,
+	346162, 345229, 344299, 343371, 342446, 341523, 340603, 339685,
+	338769, 337857, 336946, 336038, 335133, 334230, 333329, 332431,
+	331535, 330641, 329751, 328862, 327976, 327092, 326211, 325331,
+	324455, 323580, 322709, 321839, 320972, 320107, 319244, 318384,
+	317526, 316670, 315817, 314966, 314117, 313271, 312427, 311585,
+	310745, 309908, 309073, 308240, 307409, 306581, 305755, 304931,
+	304109, 303289, 302472, 301657, 300844, 300034, 299225, 298419,
+	297615, 296813, 296013, 295215, 294420, 293626, 292835, 292046,
+	291259, 290474, 289691, 288911, 288132, 287356, 286581, 285809,
+	285039, 284271, 283505, 282741, 281979, 281219, 280461, 279705,
+	278952, 278200, 277450, 276703, 275957, 275213, 274472, 273732,
+	272995, 272259, 271525, 270794, 270064, 269336, 268610, 267887,
+	267165, 266445, 265727, 265011, 264297, 263584, 262874, 262166,
+	261459, 260755, 260052, 259351, 258652, 257955, 257260, 256567,
+	255876, 255186, 254499, 253813, 253129, 252447, 251766, 251088,
+	250411, 249737, 249064, 248392, 247723, 247056, 246390, 245726,
+	245064, 244403, 243745, 243088, 242433, 241780, 241128, 240478,
+	239830, 239184, 238539, 237897, 237256, 236616, 235979, 235343,
+	234709, 234076, 233445, 232816, 232189, 231563, 230939, 230317,
+	229696, 229077, 228460, 227844, 227230, 226618, 226007, 225398,
+	224791, 224185, 223581, 222979, 222378, 221779, 221181, 220585,
+	219990, 219398, 218806, 218217, 217629, 217042, 216457, 215874,
+	215292, 214712, 214134, 213557, 212981, 212407, 211835, 211264,
+	210695, 210127, 209561, 208996, 208433, 207871, 207311, 206752,
+	206195, 205640, 205086, 204533, 203982, 203432, 202884, 202337,
+	201792, 201248, 200706, 200165, 199626, 199088, 198551, 198016,
+	197483, 196950, 196420, 195890, 195363, 194836, 194311, 193787,
+	193265, 192744, 192225, 191707, 191190, 190675, 190161, 189649,
+	189138, 188628, 188120, 187613, 187108, 186603, 186100, 185599,
+	185099, 184600, 184103, 183607, 183112, 182618, 182126, 181635,
+	181146, 180658, 180171, 179686, 179201, 178718, 178237, 177757,
+	177278, 176800, 176323, 175848, 175374, 174902, 174430, 173960,
+	173492, 173024, 172558, 172093, 171629, 171167, 170705, 170245,
+	169787, 169329, 168873, 168418, 167964, 167511, 167060, 166610,
+	166161, 165713, 165266, 164821, 164377, 163934, 163492, 163052,
+	162612, 162174, 161737, 161301, 160867, 160433, 160001, 159570,
+	159140, 158711, 158283, 157857, 157431, 157007, 156584, 156162,
+	155741, 155322, 154903, 154486, 154069, 153654, 153240, 152827,
+	152415, 152005, 151595, 151186, 150779, 150373, 149968, 149563,
+	149160, 148758, 148358, 147958, 147559, 147161, 146765, 146369,
+	145975, 145582, 145189, 144798, 144408, 144019, 143631, 143244,
+	142858, 142473, 142089, 141706, 141324, 140943, 140563, 140185,
+	139807, 139430, 139054, 138680, 138306, 137933, 137562, 137191,
+	136821, 136452, 136085, 135718, 135352, 134988, 134624, 134261,
+	133899, 133538, 133179, 132820, 132462, 132105, 131749, 131394,
+	131040, 130687, 130335, 129983, 129633, 129284, 128935, 128588,
+	128241, 127896, 127551, 127207, 126865, 126523, 126182, 125842,
+	125503, 125165, 124827, 124491, 124155, 123821, 123487, 123154,
+	122823, 122492, 122161, 121832, 121504, 121177, 120850, 120524,
+	120200, 119876, 119553, 119231, 118909, 118589, 118269, 117951,
+	117633, 117316, 117000, 116684, 116370, 116056, 115744, 115432,
+	115121, 114810, 114501, 114192, 113885, 113578, 113272, 112967,
+	112662, 112359, 112056, 111754, 111453, 111152, 110853, 110554,
+	110256, 109959, 109663, 109367, 109073, 108779, 108485, 108193,
+	107902, 107611, 107321, 107032, 106743, 106456, 106169, 105883,
+	105597, 105313, 105029, 104746, 104464, 104182, 103901, 103621,
+	103342, 103064, 102786, 102509, 102233, 101957, 101683, 101409,
+	101135, 100863, 100591, 100320, 100050, 99780, 99511, 99243,
+	98975, 98709, 98443, 98178, 97913, 97649, 97386, 97124,
+	96862, 96601, 96340, 96081, 95822, 95564, 95306, 95049,
+	94793, 94538, 94283, 94029, 93776, 93523, 93271, 93020,
+	92769, 92519, 92270, 92021, 91773, 91526, 91279, 91033,
+	90788, 90543, 90299, 90056, 89813, 89571, 89330, 89089,
+	88849, 88610, 88371, 88133, 87895, 87658, 87422, 87187,
+	86952, 86717, 86484, 86251, 86018, 85786, 85555, 85325,
+	85095, 84865, 84637, 84409, 84181, 83954, 83728, 83502,
+	83277, 83053, 82829, 82606, 82383, 82161, 81940, 81719,
+	81499, 81279, 81060, 80842, 80624, 80407, 80190, 79974,
+	79759, 79544, 79329, 79115, 78902, 78690, 78478, 78266,
+	78055, 77845, 77635, 77426, 77217, 77009, 76802, 76595,
+	76388, 76182, 75977, 75772, 75568, 75365, 75162, 74959,
+	74757, 74556, 74355, 74154, 73954, 73755, 73556, 73358,
+	73161, 72963, 72767, 72571, 72375, 72180, 71986, 71792,
+	71598, 71405, 71213, 71021, 70830, 70639, 70448, 70258,
+	70069, 69880, 69692, 69504, 69317, 69130, 68944, 68758,
+	68573, 68388, 68204, 68020, 67837, 67654, 67472, 67290,
+	67108, 66928, 66747, 66567, 66388, 66209, 66031, 65853,
+	65675, 65498, 65322, 65146, 64970, 64795, 64620, 64446,
+	64273, 64099, 63927, 63755, 63583, 63411, 63240, 63070,
+	62900, 62731, 62562, 62393, 62225, 62057, 61890, 61723,
+	61557, 61391, 61226, 61061, 60896, 60732, 60568, 60405,
+	60242, 60080, 59918, 59757, 59596, 59435, 59275, 59115,
+	58956, 58797, 58638, 58480, 58323, 58166, 58009, 57853,
+	57697, 57541, 57386, 57232, 57077, 56924, 56770, 56617,
+	56465, 56312, 56161, 56009, 55858, 55708, 55558, 55408,
+	55259, 55110, 54961, 54813, 54666, 54518, 54371, 54225,
+	54079, 53933, 53788, 53643, 53498, 53354, 53210, 53067,
+	52924, 52781, 52639, 52497, 52356, 52215, 52074, 51933,
+	51794, 51654, 51515, 51376, 51238, 51099, 50962, 50824,
+	50687, 50551, 50415, 50279, 50143, 50008, 49873, 49739,
+	49605, 49471, 49338, 49205, 49072, 48940, 48808, 48677,
+	48546, 48415, 48284, 48154, 48025, 47895, 47766, 47637,
+	47509, 47381, 47253, 47126, 46999, 46872, 46746, 46620,
+	46494, 46369, 46244, 46119, 45995, 45871, 45748, 45624,
+	45501, 45379, 45257, 45135, 45013, 44892, 44771, 44650,
+	44530, 44410, 44290, 44171, 44052, 43933, 43815, 43697,
+	43579, 43461, 43344, 43227, 43111, 42995, 42879, 42763,
+	42648, 42533, 42419, 42304, 42190, 42077, 41963, 41850,
+	41737, 41625, 41513, 41401, 41289, 41178, 41067, 40956,
+	40846, 40736, 40626, 40517, 40408, 40299, 40190, 40082,
+	39974, 39866, 39759, 39651, 39545, 39438, 39332, 39226,
+	39120, 39015, 38909, 38805, 38700, 38596, 38492, 38388,
+	38285, 38181, 38079, 37976, 37874, 37772, 37670, 37568,
+	37467, 37366, 37265, 37165, 37065, 36965, 36865, 36766,
+	36667, 36568, 36470, 36371, 36273, 36175, 36078, 35981,
+	35884, 35787, 35691, 35595, 35499, 35403, 35308, 35212,
+	35118, 35023, 34928, 34834, 34741, 34647, 34554, 34460,
+	34368, 34275, 34183, 34090, 33999, 33907, 33816, 33724,
+	33634, 33543, 33453, 33362, 33273, 33183, 33093, 33004,
+	32915, 32827, 32738, 32650, 32562, 32474, 32387, 32299,
+	32212, 32126, 32039, 31953, 31867, 31781, 31695, 31610,
+	31524, 31440, 31355, 31270, 31186, 31102, 31018, 30935,
+	30851, 30768, 30685, 30603, 30520, 30438, 30356, 30274,
+	30192, 30111, 30030, 29949, 29868, 29788, 29708, 29627,
+	29548, 29468, 29389, 29309, 29230, 29152, 29073, 28995,
+	28917, 28839, 28761, 28683, 28606, 28529, 28452, 28376,
+	28299, 28223, 28147, 28071, 27995, 27920, 27845, 27770,
+	27695, 27620, 27546, 27471, 27397, 27324, 27250, 27177,
+	27103, 27030, 26957, 26885, 26812, 26740, 26668, 26596,
+	26524, 26453, 26382, 26311, 26240, 26169, 26098, 26028,
+	25958, 25888, 25818, 25749, 25679, 25610, 25541, 25472,
+	25404, 25335, 25267, 25199, 25131, 25063, 24996, 24928,
+	24861, 24794, 24727, 24661, 24594, 24528, 24462, 24396,
+	24330, 24265, 24199, 24134, 24069, 24004, 23939, 23875,
+	23811, 23746, 23682, 23619, 23555, 23492, 23428, 23365,
+	23302, 23239, 23177, 23114, 23052, 22990, 22928, 22866,
+	22804, 22743, 22682, 22621, 22560, 22499, 22438, 22378,
+	22317, 22257, 22197, 22138, 22078, 22018, 21959, 21900,
+	21841, 21782, 21723, 21665, 21606, 21548, 21490, 21432,
+	21374, 21317, 21259, 21202, 21145, 21088, 21031, 20974,
+	20918, 20862, 20805, 20749, 20693, 20638, 20582, 20527,
+	20471, 20416, 20361, 20306, 20251, 20197, 20142, 20088,
+	20034, 19980, 19926, 19873, 19819, 19766, 19712, 19659,
+	19606, 19553, 19501, 19448, 19396, 19343, 19291, 19239,
+	19188, 19136, 19084, 19033, 18982, 18930, 18879, 18828,
+	18778, 18727, 18677, 18626, 18576, 18526, 18476, 18426,
+	18377, 18327, 18278, 18229, 18179, 18130, 18082, 18033,
+	17984, 17936, 17887, 17839, 17791, 17743, 17695, 17648,
+	17600, 17553, 17505, 17458, 17411, 17364, 17318, 17271,
+	17224, 17178, 17132, 17085, 17039, 16993, 16948, 16902,
+	16856, 16811, 16766, 16721, 16676, 16631, 16586, 16541,
+	16496, 16452, 16408, 16363, 16319, 16275, 16232, 16188,
+	16144, 16101, 16057, 16014, 15971, 15928, 15885, 15842,
+	15799, 15757, 15714, 15672, 15630, 15588, 15546, 15504,
+	15462, 15420, 15379, 15337, 15296, 15255, 15214, 15173,
+	15132, 15091, 15050, 15010, 14969, 14929, 14889, 14849,
+	14809, 14769, 14729, 14689, 14650, 14610, 14571, 14532,
+	14492, 14453, 14414, 14376, 14337, 14298, 14260, 14221,
+	14183, 14145, 14107, 14069, 14031, 13993, 13955, 13917,
+	13880, 13843, 13805, 13768, 13731, 13694, 13657, 13620,
+	13584, 13547, 13510, 13474, 13438, 13402, 13365, 13329,
+	13293, 13258, 13222, 13186, 13151, 13115, 13080, 13045,
+	13010, 12975, 12940, 12905, 12870, 12835, 12801, 12766,
+	12732, 12697, 12663, 12629, 12595, 12561, 12527, 12494,
+	12460, 12426, 12393, 12359, 12326, 12293, 12260, 12227,
+	12194, 12161, 12128, 12095, 12063, 12030, 11998, 11966,
+	11933, 11901, 11869, 11837, 11805, 11773, 11742, 11710,
+	11678, 11647, 11616, 11584, 11553, 11522, 11491, 11460,
+	11429, 11398, 11368, 11337, 11306, 11276, 11246, 11215,
+	11185, 11155, 11125, 11095, 11065, 11035, 11005, 10976,
+	10946, 10917, 10887, 10858, 10829, 10799, 10770, 10741,
+	10712, 10683, 10655, 10626, 10597, 10569, 10540, 10512,
+	10484, 10455, 10427, 10399, 10371, 10343, 10315, 10287,
+	10260, 10232, 10204, 10177, 10150, 10122, 10095, 10068,
+	10041, 10014, 9987, 9960, 9933, 9906, 9879, 9853,
+	9826, 9800, 9773, 9747, 9721, 9694, 9668, 9642,
+	9616, 9590, 9565, 9539, 9513, 9487, 9462, 9436,
+	9411, 9386, 9360, 9335, 9310, 9285, 9260, 9235,
+	9210, 9185, 9160, 9136, 9111, 9086, 9062, 9038,
+	9013, 8989, 8965, 8941, 8916, 8892, 8868, 8845,
+	8821, 8797, 8773, 8750, 8726, 8703, 8679, 8656,
+	8632, 8609, 8586, 8563, 8540, 8517, 8494, 8471,
+	8448, 8425, 8403, 8380, 8357, 8335, 8312, 8290,
+	8268, 8245, 8223, 8201, 8179, 8157, 8135, 8113,
+	8091, 8069, 8047, 8026, 8004, 7983, 7961, 7940,
+	7918, 7897, 7876, 7854, 7833, 7812, 7791, 7770,
+	7749, 7728, 7707, 7687, 7666, 7645, 7625, 7604,
+	7584, 7563, 7543, 7522, 7502, 7482, 7462, 7442,
+	7422, 7402, 7382, 7362, 7342, 7322, 7302, 7283,
+	7263, 7244, 7224, 7205, 7185, 7166, 7146, 7127,
+	7108, 7089, 7070, 7051, 7032, 7013, 6994, 6975,
+	6956, 6937, 6919, 6900, 6882, 6863, 6845, 6826,
+	6808, 6789, 6771, 6753, 6735, 6716, 6698, 6680,
+	6662, 6644, 6626, 6609, 6591, 6573, 6555, 6538,
+	6520, 6502, 6485, 6467, 6450, 6433, 6415, 6398,
+	6381, 6364, 6346, 6329, 6312, 6295, 6278, 6261,
+	6244, 6228, 6211, 6194, 6177, 6161, 6144, 6128,
+	6111, 6095, 6078, 6062, 6045, 6029, 6013, 5997,
+	5981, 5964, 5948, 5932, 5916, 5900, 5885, 5869,
+	5853, 5837, 5821, 5806, 5790, 5774, 5759, 5743,
+	5728, 5712, 5697, 5682, 5666, 5651, 5636, 5621,
+	5606, 5590, 5575, 5560, 5545, 5530, 5515, 5501,
+	5486, 5471, 5456, 5442, 5427, 5412, 5398, 5383,
+	5369, 5354, 5340, 5325, 5311, 5297, 5282, 5268,
+	5254, 5240, 5226, 5212, 5198, 5184, 5170, 5156,
+	5142, 5128, 5114, 5100, 5087, 5073, 5059, 5046,
+	5032, 5018, 5005, 4991, 4978, 4965, 4951, 4938,
+	4924, 4911, 4898, 4885, 4872, 4858, 4845, 4832,
+	4819, 4806, 4793, 4780, 4768, 4755, 4742, 4729,
+	4716, 4704, 4691, 4678, 4666, 4653, 4641, 4628,
+	4616, 4603, 4591, 4578, 4566, 4554, 4542, 4529,
+	4517, 4505, 4493, 4481, 4469, 4457, 4445, 4433,
+	4421, 4409, 4397, 4385, 4373, 4361, 4350, 4338,
+	4326, 4315, 4303, 4291, 4280, 4268, 4257, 4245,
+	4234, 4222, 4211, 4200, 4188, 4177, 4166, 4155,
+	4143, 4132, 4121, 4110, 4099, 4088, 4077, 4066,
+	4055, 4044, 4033, 4022, 4011, 4001, 3990, 3979,
+	3968, 3958, 3947, 3936, 3926, 3915, 3905, 3894,
+	3884, 3873, 3863, 3852, 3842, 3831, 3821, 3811,
+	3801, 3790, 3780, 3770, 3760, 3750, 3740, 3729,
+	3719, 3709, 3699, 3689, 3679, 3670, 3660, 3650,
+	3640, 3630, 3620, 3611, 3601, 3591, 3581, 3572,
+	3562, 3553, 3543, 3533, 3524, 3514, 3505, 3496,
+	3486, 3477, 3467, 3458, 3449, 3439, 3430, 3421,
+	3412, 3402, 3393, 3384, 3375, 3366, 3357, 3348,
+	3339, 3330, 3321, 3312, 3303, 3294, 3285, 3276,
+	3267, 3259, 3250, 3241, 3232, 3224, 3215, 3206,
+	3198, 3189, 3180, 3172, 3163, 3155, 3146, 3138,
+	3129, 3121, 3113, 3104, 3096, 3087, 3079, 3071,
+	3063, 3054, 3046, 3038, 3030, 3022, 3013, 3005,
+	2997, 2989, 2981, 2973, 2965, 2957, 2949, 2941,
+	2933, 2925, 2917, 2909, 2902, 2894, 2886, 2878,
+	2870, 2863, 2855, 2847, 2840, 2832, 2824, 2817,
+	2809, 2802, 2794, 2787, 2779, 2772, 2764, 2757,
+	2749, 2742, 2734, 2727, 2720, 2712, 2705, 2698,
+	2690, 2683, 2676, 2669, 2662, 2654, 2647, 2640,
+	2633, 2626, 2619, 2612, 2605, 2598, 2591, 2584,
+	2577, 2570, 2563, 2556, 2549, 2542, 2535, 2529,
+	2522, 2515, 2508, 2501, 2495, 2488, 2481, 2475,
+	2468, 2461, 2455, 2448, 2441, 2435, 2428, 2422,
+	2415, 2409, 2402, 2396, 2389, 2383, 2376, 2370,
+	2364, 2357, 2351, 2344, 2338, 2332, 2326, 2319,
+	2313, 2307, 2301, 2294, 2288, 2282, 2276, 2270,
+	2264, 2258, 2251, 2245, 2239, 2233, 2227, 2221,
+	2215, 2209, 2203, 2197, 2192, 2186, 2180, 2174,
+	2168, 2162, 2156, 2150, 2145, 2139, 2133, 2127,
+	2122, 2116, 2110, 2105, 2099, 2093, 2088, 2082,
+	2076, 2071, 2065, 2060, 2054, 2049, 2043, 2037,
+	2032, 2027, 2021, 2016, 2010, 2005, 1999, 1994,
+	1989, 1983, 1978, 1973, 1967, 1962, 1957, 1951,
+	1946, 1941, 1936, 1930, 1925, 1920, 1915, 1910,
+	1905, 1899, 1894, 1889, 1884, 1879, 1874, 1869,
+	1864, 1859, 1854, 1849, 1844, 1839, 1834, 1829,
+	1824, 1819, 1814, 1809, 1804, 1800, 1795, 1790,
+	1785, 1780, 1775, 1771, 1766, 1761, 1756, 1752,
+	1747, 1742, 1738, 1733, 1728, 1724, 1719, 1714,
+	1710, 1705, 1700, 1696, 1691, 1687, 1682, 1678,
+	1673, 1669, 1664, 1660, 1655, 1651, 1646, 1642,
+	1637, 1633, 1629, 1624, 1620, 1615, 1611, 1607,
+	1602, 1598, 1594, 1589, 1585, 1581, 1577, 1572,
+	1568, 1564, 1560, 1556, 1551, 1547, 1543, 1539,
+	1535, 1531, 1526, 1522, 1518, 1514, 1510, 1506,
+	1502, 1498, 1494, 1490, 1486, 1482, 1478, 1474,
+	1470, 1466, 1462, 1458, 1454, 1450, 1446, 1442,
+	1438, 1435, 1431, 1427, 1423, 1419, 1415, 1411,
+	1408, 1404, 1400, 1396, 1393, 1389, 1385, 1381,
+	1378, 1374, 1370, 1366, 1363, 1359, 1355, 1352,
+	1348, 1345, 1341, 1337, 1334, 1330, 1327, 1323,
+	1319, 1316, 1312, 1309, 1305, 1302, 1298, 1295,
+	1291, 1288, 1284, 1281, 1277, 1274, 1270, 1267,
+	1264, 1260, 1257, 1253, 1250, 1247, 1243, 1240,
+	1237, 1233, 1230, 1227, 1223, 1220, 1217, 1213,
+	1210, 1207, 1204, 1200, 1197, 1194, 1191, 1188,
+	1184, 1181, 1178, 1175, 1172, 1168, 1165, 1162,
+	1159, 1156, 1153, 1150, 1147, 1143, 1140, 1137,
+	1134, 1131, 1128, 1125, 1122, 1119, 1116, 1113,
+	1110, 1107, 1104, 1101, 1098, 1095, 1092, 1089,
+	1086, 1083, 1080, 1078, 1075, 1072, 1069, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	-67108863, -66928024, -66747673, -66567807, -66388427, -66209530, -66031114, -65853180,
+	-65675725, -65498749, -65322249, -65146225, -64970675, -64795598, -64620993, -64446859,
+	-64273193, -64099996, -63927265, -63755000, -63583199, -63411861, -63240985, -63070569,
+	-62900613, -62731114, -62562073, -62393486, -62225354, -62057675, -61890448, -61723672,
+	-61557345, -61391466, -61226034, -61061048, -60896506, -60732408, -60568752, -60405537,
+	-60242762, -60080426, -59918527, -59757064, -59596036, -59435443, -59275282, -59115552,
+	-58956253, -58797384, -58638942, -58480928, -58323339, -58166175, -58009434, -57853116,
+	-57697219, -57541742, -57386684, -57232043, -57077820, -56924012, -56770619, -56617639,
+	-56465071, -56312914, -56161167, -56009830, -55858900, -55708376, -55558259, -55408546,
+	-55259236, -55110329, -54961823, -54813717, -54666010, -54518701, -54371789, -54225274,
+	-54079152, -53933425, -53788090, -53643147, -53498595, -53354432, -53210658, -53067271,
+	-52924270, -52781655, -52639424, -52497576, -52356111, -52215026, -52074322, -51933997,
+	-51794051, -51654481, -51515287, -51376469, -51238024, -51099953, -50962254, -50824926,
+	-50687967, -50551378, -50415157, -50279303, -50143815, -50008693, -49873934, -49739539,
+	-49605505, -49471833, -49338521, -49205568, -49072974, -48940737, -48808856, -48677330,
+	-48546159, -48415342, -48284877, -48154763, -48025000, -47895587, -47766523, -47637806,
+	-47509436, -47381412, -47253733, -47126398, -46999407, -46872757, -46746449, -46620481,
+	-46494853, -46369563, -46244611, -46119995, -45995715, -45871770, -45748159, -45624882,
+	-45501936, -45379322, -45257038, -45135084, -45013458, -44892160, -44771189, -44650544,
+	-44530224, -44410228, -44290555, -44171205, -44052177, -43933469, -43815082, -43697013,
+	-43579262, -43461829, -43344712, -43227911, -43111425, -42995252, -42879393, -42763845,
+	-42648609, -42533684, -42419068, -42304761, -42190763, -42077071, -41963686, -41850606,
+	-41737831, -41625360, -41513192, -41401326, -41289762, -41178498, -41067534, -40956869,
+	-40846502, -40736433, -40626661, -40517184, -40408002, -40299114, -40190520, -40082218,
+	-39974209, -39866490, -39759062, -39651923, -39545072, -39438510, -39332235, -39226246,
+	-39120543, -39015125, -38909991, -38805140, -38700571, -38596285, -38492279, -38388554,
+	-38285108, -38181941, -38079052, -37976440, -37874105, -37772045, -37670261, -37568750,
+	-37467514, -37366550, -37265858, -37165438, -37065288, -36965408, -36865797, -36766454,
+	-36667380, -36568572, -36470030, -36371754, -36273743, -36175996, -36078513, -35981292,
+	-35884333, -35787635, -35691198, -35595021, -35499103, -35403443, -35308041, -35212896,
+	-35118008, -35023375, -34928998, -34834874, -34741005, -34647388, -34554024, -34460911,
+	-34368049, -34275437, -34183075, -34090961, -33999096, -33907479, -33816108, -33724984,
+	-33634105, -33543471, -33453081, -33362935, -33273032, -33183371, -33093951, -33004773,
+	-32915835, -32827136, -32738677, -32650456, -32562473, -32474726, -32387216, -32299942,
+	-32212904, -32126099, -32039529, -31953192, -31867088, -31781215, -31695574, -31610164,
+	-31524984, -31440033, -31355312, -31270818, -31186553, -31102514, -31018702, -30935116,
+	-30851755, -30768619, -30685706, -30603017, -30520551, -30438307, -30356285, -30274484,
+	-30192903, -30111542, -30030400, -29949477, -29868772, -29788285, -29708014, -29627960,
+	-29548121, -29468498, -29389089, -29309894, -29230913, -29152144, -29073587, -28995243,
+	-28917109, -28839186, -28761473, -28683969, -28606674, -28529588, -28452709, -28376037,
+	-28299572, -28223313, -28147260, -28071411, -27995767, -27920327, -27845090, -27770056,
+	-27695223, -27620593, -27546164, -27471935, -27397906, -27324077, -27250447, -27177015,
+	-27103781, -27030744, -26957904, -26885260, -26812813, -26740560, -26668502, -26596638,
+	-26524968, -26453491, -26382207, -26311115, -26240214, -26169504, -26098985, -26028656,
+	-25958517, -25888566, -25818804, -25749230, -25679843, -25610644, -25541631, -25472804,
+	-25404162, -25335705, -25267433, -25199345, -25131440, -25063718, -24996179, -24928821,
+	-24861646, -24794651, -24727837, -24661202, -24594748, -24528472, -24462375, -24396456,
+	-24330715, -24265151, -24199764, -24134552, -24069517, -24004657, -23939971, -23875460,
+	-23811123, -23746959, -23682968, -23619149, -23555502, -23492027, -23428723, -23365590,
+	-23302626, -23239833, -23177208, -23114752, -23052465, -22990345, -22928393, -22866608,
+	-22804989, -22743537, -22682249, -22621127, -22560170, -22499377, -22438748, -22378282,
+	-22317979, -22257839, -22197861, -22138044, -22078388, -22018894, -21959559, -21900385,
+	-21841370, -21782514, -21723816, -21665277, -21606895, -21548671, -21490604, -21432693,
+	-21374938, -21317339, -21259895, -21202606, -21145471, -21088491, -21031663, -20974989,
+	-20918468, -20862099, -20805881, -20749816, -20693901, -20638137, -20582524, -20527060,
+	-20471745, -20416580, -20361563, -20306695, -20251974, -20197401, -20142975, -20088696,
+	-20034563, -19980576, -19926734, -19873037, -19819485, -19766078, -19712814, -19659694,
+	-19606717, -19553882, -19501190, -19448640, -19396232, -19343965, -19291839, -19239853,
+	-19188007, -19136301, -19084734, -19033307, -18982017, -18930867, -18879853, -18828978,
+	-18778239, -18727637, -18677172, -18626843, -18576649, -18526590, -18476666, -18426877,
+	-18377222, -18327701, -18278313, -18229059, -18179937, -18130947, -18082090, -18033364,
+	-17984769, -17936306, -17887973, -17839770, -17791697, -17743753, -17695939, -17648254,
+	-17600697, -17553268, -17505968, -17458794, -17411748, -17364828, -17318035, -17271368,
+	-17224827, -17178411, -17132120, -17085954, -17039913, -16993995, -16948201, -16902531,
+	-16856984, -16811559, -16766257, -16721077, -16676018, -16631082, -16586266, -16541571,
+	-16496996, -16452541, -16408207, -16363991, -16319895, -16275918, -16232059, -16188319,
+	-16144696, -16101191, -16057803, -16014532, -15971377, -15928339, -15885417, -15842610,
+	-15799919, -15757343, -15714882, -15672535, -15630302, -15588183, -15546177, -15504285,
+	-15462505, -15420839, -15379284, -15337841, -15296510, -15255291, -15214182, -15173185,
+	-15132297, -15091520, -15050853, -15010295, -14969847, -14929508, -14889277, -14849155,
+	-14809141, -14769235, -14729436, -14689744, -14650160, -14610682, -14571311, -14532045,
+	-14492886, -14453832, -14414883, -14376039, -14337300, -14298665, -14260134, -14221707,
+	-14183384, -14145164, -14107047, -14069033, -14031121, -13993311, -13955603, -13917997,
+	-13880492, -13843088, -13805785, -13768583, -13731481, -13694478, -13657576, -13620773,
+	-13584069, -13547464, -13510957, -13474549, -13438239, -13402027, -13365913, -13329895,
+	-13293975, -13258152, -13222425, -13186795, -13151260, -13115821, -13080478, -13045230,
+	-13010077, -12975019, -12940055, -12905185, -12870409, -12835728, -12801139, -12766644,
+	-12732241, -12697932, -12663715, -12629590, -12595557, -12561615, -12527765, -12494007,
+	-12460339, -12426762, -12393276, -12359880, -12326573, -12293357, -12260230, -12227192,
+	-12194244, -12161384, -12128612, -12095929, -12063334, -12030827, -11998408, -11966075,
+	-11933830, -11901672, -11869601, -11837616, -11805717, -11773904, -11742177, -11710535,
+	-11678979, -11647507, -11616121, -11584819, -11553601, -11522467, -11491418, -11460452,
+	-11429569, -11398770, -11368054, -11337420, -11306869, -11276400, -11246014, -11215709,
+	-11185486, -11155344, -11125284, -11095305, -11065406, -11035588, -11005851, -10976193,
+	-10946615, -10917118, -10887699, -10858360, -10829100, -10799919, -10770816, -10741792,
+	-10712846, -10683978, -10655188, -10626475, -10597840, -10569282, -10540801, -10512397,
+	-10484069, -10455817, -10427642, -10399543, -10371519, -10343571, -10315698, -10287900,
+	-10260177, -10232529, -10204955, -10177456, -10150031, -10122679, -10095402, -10068198,
+	-10041067, -10014009, -9987024, -9960112, -9933273, -9906505, -9879810, -9853187,
+	-9826636, -9800156, -9773747, -9747410, -9721144, -9694948, -9668823, -9642768,
+	-9616784, -9590870, -9565025, -9539250, -9513545, -9487908, -9462341, -9436843,
+	-9411414, -9386053, -9360760, -9335535, -9310379, -9285290, -9260269, -9235315,
+	-9210429, -9185610, -9160857, -9136171, -9111552, -9086999, -9062512, -9038091,
+	-9013736, -8989447, -8965223, -8941065, -8916971, -8892942, -8868979, -8845079,
+	-8821244, -8797474, -8773767, -8750124, -8726545, -8703030, -8679578, -8656189,
+	-8632863, -8609600, -8586400, -8563262, -8540187, -8517173, -8494222, -8471333,
+	-8448505, -8425739, -8403034, -8380390, -8357807, -8335285, -8312824, -8290424,
+	-8268084, -8245803, -8223583, -8201423, -8179323, -8157282, -8135301, -8113378,
+	-8091515, -8069711, -8047965, -8026279, -8004650, -7983080, -7961568, -7940114,
+	-7918718, -7897379, -7876098, -7854874, -7833708, -7812598, -7791545, -7770549,
+	-7749610, -7728727, -7707901, -7687130, -7666415, -7645757, -7625154, -7604606,
+	-7584114, -7563677, -7543295, -7522968, -7502696, -7482478, -7462315, -7442207,
+	-7422152, -7402152, -7382205, -7362312, -7342473, -7322687, -7302955, -7283275,
+	-7263649, -7244076, -7224555, -7205087, -7185671, -7166308, -7146997, -7127738,
+	-7108531, -7089375, -7070272, -7051219, -7032218, -7013269, -6994370, -6975522,
+	-6956725, -6937979, -6919283, -6900638, -6882042, -6863497, -6845002, -6826557,
+	-6808161, -6789816, -6771519, -6753272, -6735074, -6716925, -6698824, -6680773,
+	-6662770, -6644816, -6626910, -6609053, -6591243, -6573482, -6555768, -6538102,
+	-6520484, -6502913, -6485390, -6467914, -6450485, -6433103, -6415767, -6398479,
+	-6381237, -6364041, -6346892, -6329789, -6312732, -6295721, -6278756, -6261836,
+	-6244963, -6228134, -6211351, -6194614, -6177921, -6161273, -6144670, -6128112,
+	-6111599, -6095130, -6078705, -6062325, -6045989, -6029697, -6013448, -5997244,
+	-5981083, -5964966, -5948892, -5932862, -5916874, -5900930, -5885029, -5869170,
+	-5853355, -5837582, -5821851, -5806163, -5790517, -5774913, -5759352, -5743832,
+	-5728354, -5712918, -5697523, -5682170, -5666858, -5651588, -5636358, -5621170,
+	-5606023, -5590916, -5575850, -5560825, -5545840, -5530896, -5515992, -5501128,
+	-5486304, -5471520, -5456776, -5442071, -5427406, -5412781, -5398195, -5383649,
+	-5369141, -5354673, -5340244, -5325853, -5311502, -5297189, -5282915, -5268679,
+	-5254481, -5240322, -5226201, -5212118, -5198073, -5184065, -5170096, -5156164,
+	-5142270, -5128413, -5114593, -5100811, -5087066, -5073357, -5059686, -5046052,
+	-5032454, -5018893, -5005369, -4991881, -4978429, -4965014, -4951635, -4938291,
+	-4924984, -4911713, -4898477, -4885277, -4872113, -4858984, -4845890, -4832832,
+	-4819809, -4806821, -4793868, -4780950, -4768067, -4755218, -4742404, -4729625,
+	-4716880, -4704169, -4691493, -4678851, -4666243, -4653669, -4641128, -4628622,
+	-4616149, -4603710, -4591304, -4578932, -4566593, -4554288, -4542015, -4529776,
+	-4517569, -4505396, -4493255, -4481147, -4469072, -4457029, -4445019, -4433041,
+	-4421095, -4409181, -4397300, -4385450, -4373633, -4361847, -4350093, -4338371,
+	-4326681, -4315021, -4303394, -4291797, -4280232, -4268698, -4257195, -4245723,
+	-4234282, -4222872, -4211493, -4200144, -4188826, -4177538, -4166281, -4155054,
+	-4143858, -4132691, -4121555, -4110448, -4099372, -4088325, -4077309, -4066321,
+	-4055364, -4044436, -4033537, -4022668, -4011828, -4001018, -3990236, -3979483,
+	-3968760, -3958065, -3947399, -3936762, -3926154, -3915574, -3905023, -3894500,
+	-3884005, -3873539, -3863101, -3852691, -3842309, -3831955, -3821629, -3811331,
+	-3801061, -3790818, -3780603, -3770415, -3760255, -3750122, -3740017, -3729939,
+	-3719888, -3709864, -3699867, -3689897, -3679953, -3670037, -3660147, -3650284,
+	-3640448, -3630638, -3620854, -3611097, -3601367, -3591662, -3581983, -3572331,
+	-3562705, -3553104, -3543530, -3533981, -3524458, -3514960, -3505489, -3496042,
+	-3486622, -3477226, -3467856, -3458511, -3449192, -3439897, -3430628, -3421383,
+	-3412163, -3402969, -3393799, -3384653, -3375533, -3366437, -3357365, -3348318,
+	-3339295, -3330297, -3321323, -3312373, -3303447, -3294545, -3285667, -3276813,
+	-3267983, -3259177, -3250394, -3241636, -3232900, -3224189, -3215500, -3206836,
+	-3198194, -3189576, -3180981, -3172409, -3163860, -3155335, -3146832, -3138352,
+	-3129895, -3121461, -3113050, -3104661, -3096295, -3087951, -3079630, -3071331,
+	-3063055, -3054801, -3046569, -3038360, -3030172, -3022007, -3013863, -3005742,
+	-2997642, -2989565, -2981509, -2973474, -2965462, -2957471, -2949501, -2941553,
+	-2933626, -2925721, -2917837, -2909974, -2902133, -2894313, -2886513, -2878735,
+	-2870978, -2863241, -2855526, -2847831, -2840157, -2832503, -2824871, -2817258,
+	-2809667, -2802095, -2794545, -2787014, -2779504, -2772014, -2764544, -2757095,
+	-2749665, -2742256, -2734866, -2727496, -2720147, -2712817, -2705506, -2698216,
+	-2690945, -2683694, -2676462, -2669250, -2662057, -2654883, -2647729, -2640594,
+	-2633479, -2626382, -2619305, -2612247, -2605207, -2598187, -2591186, -2584203,
+	-2577240, -2570295, -2563369, -2556461, -2549572, -2542702, -2535850, -2529017,
+	-2522202, -2515405, -2508627, -2501867, -2495125, -2488401, -2481696, -2475008,
+	-2468339, -2461687, -2455054, -2448438, -2441840, -2435260, -2428698, -2422154,
+	-2415627, -2409117, -2402625, -2396151, -2389694, -2383254, -2376832, -2370427,
+	-2364040, -2357669, -2351316, -2344980, -2338661, -2332359, -2326074, -2319806,
+	-2313555, -2307320, -2301103, -2294902, -2288718, -2282551, -2276400, -2270266,
+	-2264148, -2258047, -2251962, -2245894, -2239841, -2233806, -2227786, -2221783,
+	-2215796, -2209825, -2203870, -2197932, -2192009, -2186102, -2180211, -2174336,
+	-2168477, -2162633, -2156806, -2150994, -2145197, -2139417, -2133652, -2127902,
+	-2122168, -2116449, -2110746, -2105058, -2099386, -2093729, -2088087, -2082460,
+	-2076848, -2071252, -2065670, -2060104, -2054553, -2049016, -2043495, -2037988,
+	-2032496, -2027019, -2021557, -2016110, -2010677, -2005259, -1999855, -1994466,
+	-1989092, -1983732, -1978386, -1973055, -1967738, -1962436, -1957147, -1951873,
+	-1946614, -1941368, -1936137, -1930919, -1925716, -1920527, -1915352, -1910190,
+	-1905043, -1899909, -1894790, -1889684, -1884592, -1879513, -1874449, -1869397,
+	-1864360, -1859336, -1854326, -1849329, -1844345, -1839375, -1834419, -1829476,
+	-1824546, -1819629, -1814726, -1809836, -1804959, -1800095, -1795244, -1790406,
+	-1785582, -1780770, -1775972, -1771186, -1766413, -1761653, -1756906, -1752172,
+	-1747450, -1742741, -1738045, -1733361, -1728691, -1724032, -1719386, -1714753,
+	-1710132, -1705524, -1700928, -1696345, -1691774, -1687215, -1682668, -1678134,
+	-1673612, -1669102, -1664604, -1660119, -1655645, -1651184, -1646734, -1642297,
+	-1637871, -1633458, -1629056, -1624666, -1620288, -1615922, -1611567, -1607225,
+	-1602894, -1598574, -1594267, -1589971, -1585686, -1581413, -1577152, -1572902,
+	-1568663, -1564436, -1560221, -1556016, -1551823, -1547641, -1543471, -1539312,
+	-1535164, -1531027, -1526901, -1522787, -1518683, -1514591, -1510510, -1506439,
+	-1502380, -1498331, -1494294, -1490267, -1486251, -1482246, -1478252, -1474269,
+	-1470296, -1466334, -1462383, -1458442, -1454512, -1450592, -1446683, -1442785,
+	-1438897, -1435020, -1431153, -1427296, -1423450, -1419614, -1415789, -1411974,
+	-1408169, -1404374, -1400590, -1396816, -1393052, -1389298, -1385554, -1381820,
+	-1378097, -1374383, -1370680, -1366986, -1363302, -1359629, -1355965, -1352311,
+	-1348667, -1345033, -1341408, -1337794, -1334189, -1330593, -1327008, -1323432,
+	-1319866, -1316309, -1312762, -1309224, -1305696, -1302178, -1298669, -1295169,
+	-1291679, -1288199, -1284727, -1281265, -1277813, -1274369, -1270935, -1267511,
+	-1264095, -1260689, -1257291, -1253903, -1250525, -1247155, -1243794, -1240442,
+	-1237100, -1233766, -1230441, -1227126, -1223819, -1220521, -1217232, -1213952,
+	-1210681, -1207419, -1204165, -1200920, -1197684, -1194456, -1191238, -1188028,
+	-1184826, -1181634, -1178449, -1175274, -1172107, -1168948, -1165798, -1162657,
+	-1159524, -1156399, -1153283, -1150175, -1147076, -1143985, -1140902, -1137828,
+	-1134762, -1131704, -1128654, -1125613, -1122580, -1119555, -1116538, -1113529,
+	-1110528, -1107536, -1104551, -1101575, -1098607, -1095646, -1092694, -1089749,
+	-1086813, -1083884, -1080963, -1078050, -1075145, -1072248, -1069359, -1066477,
+	-1063603, -1060737, -1057879, -1055028, -1052185, -1049350, -1046522, -1043702,
+	-1040890, -1038085, -1035287, -1032498, -1029715, -1026941, -1024173, -1021413,
+	-1018661, -1015916, -1013178, -1010448, -1007725, -1005010, -1002302, -999601,
+	-996907, -994221, -991542, -988870, -986205, -983547, -980897, -978254,
+	-975618, -972989, -970367, -967752, -965144, -962543, -959950, -957363,
+	-954783, -952210, -949644, -947085, -944533, -941988, -939449, -936918,
+	-934393, -931875, -929364, -926860, -924362, -921871, -919387, -916910,
+	-914439, -911975, -909517, -907066, -904622, -902184, -899753, -897329,
+	-894911, -892499, -890094, -887695, -885303, -882918, -880539, -878166,
+	-875799, -873439, -871086, -868738, -866397, -864063, -861734, -859412,
+	-857096, -854787, -852483, -850186, -847895, -845610, -843332, -841059,
+	-838793, -836532, -834278, -832030, -829788, -827552, -825322, -823098,
+	-820880, -818668, -816462, -814262, -812067, -809879, -807697, -805520,
+	-803350, -801185, -799026, -796873, -794725, -792584, -790448, -788318,
+	-786194, -784075, -781962, -779855, -777754, -775658, -773568, -771483,
+	-769404, -767331, -765263, -763201, -761144, -759093, -757048, -755008,
+	-752973, -750944, -748921, -746903, -744890, -742883, -740881, -738884,
+	-736893, -734908, -732927, -730952, -728982, -727018, -725059, -723105,
+	-721157, -719213, -717275, -715342, -713415, -711492, -709575, -707663,
+	-705756, -703854, -701958, -700066, -698179, -696298, -694422, -692550,
+	-690684, -688823, -686967, -685116, -683270, -681428, -679592, -677761,
+	-675934, -674113, -672296, -670485, -668678, -666876, -665079, -663287,
+	-661500, -659717, -657939, -656166, -654398, -652635, -650876, -649122,
+	-647373, -645628, -643889, -642154, -640423, -638697, -636976, -635260,
+	-633548, -631841, -630138, -628440, -626747, -625058, -623373, -621694,
+	-620018, -618348, -616681, -615020, -613362, -611709, -610061, -608417,
+	-606778, -605142, -603512, -601886, -600264, -598646, -597033, -595424,
+	-593820, -592219, -590624, -589032, -587445, -585862, -584283, -582709,
+	-581138, -579572, -578011, -576453, -574900, -573350, -571805, -570265,
+	-568728, -567195, -565667, -564143, -562622, -561106, -559594, -558086,
+	-556582, -555083, -553587, -552095, -550607, -549124, -547644, -546168,
+	-544696, -543229, -541765, -540305, -538849, -537397, -535949, -534504,
+	-533064, -531628, -530195, -528766, -527342, -525920, -524503, -523090,
+	-521680, -520275, -518873, -517474, -516080, -514689, -513302, -511919,
+	-510540, -509164, -507792, -506423, -505059, -503698, -502341, -500987,
+	-499637, -498290, -496948, -495609, -494273, -492941, -491613, -490288,
+	-488967, -487649, -486335, -485025, -483718, -482414, -481114, -479818,
+	-478525, -477235, -475949, -474667, -473388, -472112, -470840, -469571,
+	-468306, -467044, -465785, -464530, -463278, -462030, -460785, -459543,
+	-458305, -457070, -455838, -454610, -453385, -452163, -450945, -449729,
+	-448518, -447309, -446104, -444901, -443703, -442507, -441314, -440125,
+	-438939, -437756, -436577, -435400, -434227, -433057, -431890, -430726,
+	-429565, -428408, -427253, -426102, -424954, -423809, -422667, -421528,
+	-420392, -419259, -418129, -417003, -415879, -414758, -413641, -412526,
+	-411414, -410306, -409200, -408097, -406998, -405901, -404807, -403716,
+	-402628, -401543, -400461, -399382, -398306, -397233, -396162, -395095,
+	-394030, -392968, -391909, -390853, -389800, -388750, -387702, -386657,
+	-385615, -384576, -383540, -382506, -381476, -380448, -379422, -378400,
+	-377380, -376363, -375349, -374338, -373329, -372323, -371320, -370319,
+	-369321, -368326, -367334, -366344, -365356, -364372, -363390, -362411,
+	-361434, -360460, -359489, -358520, -357554, -356591, -355630, -354671,
+	-353716, -352762, -351812, -350864, -349918, -348975, -348035, -347097,
+	-346162, -345229, -344299, -343371, -342446, -341523, -340603, -339685,
+	-338769, -337857, -336946, -336038, -335133, -334230, -333329, -332431,
+	-331535, -330641, -329751, -328862, -327976, -327092, -326211, -325331,
+	-324455, -323580, -322709, -321839, -320972, -320107, -319244, -318384,
+	-317526, -316670, -315817, -314966, -314117, -313271, -312427, -311585,
+	-310745, -309908, -309073, -308240, -307409, -306581, -305755, -304931,
+	-304109, -303289, -302472, -301657, -300844, -300034, -299225, -298419,
+	-297615, -296813, -296013, -295215, -294420, -293626, -292835, -292046,
+	-291259, -290474, -289691, -288911, -288132, -287356, -286581, -285809,
+	-285039, -284271, -283505, -282741, -281979, -281219, -280461, -279705,
+	-278952, -278200, -277450, -276703, -275957, -275213, -274472, -273732,
+	-272995, -272259, -271525, -270794, -270064, -269336, -268610, -267887,
+	-267165, -266445, -265727, -265011, -264297, -263584, -262874, -262166,
+	-261459, -260755, -260052, -259351, -258652, -257955, -257260, -256567,
+	-255876, -255186, -254499, -253813, -253129, -252447, -251766, -251088,
+	-250411, -249737, -249064, -248392, -247723, -247056, -246390, -245726,
+	-245064, -244403, -243745, -243088, -242433, -241780, -241128, -240478,
+	-239830, -239184, -238539, -237897, -237256, -236616, -235979, -235343,
+	-234709, -234076, -233445, -232816, -232189, -231563, -230939, -230317,
+	-229696, -229077, -228460, -227844, -227230, -226618, -226007, -225398,
+	-224791, -224185, -223581, -222979, -222378, -221779, -221181, -220585,
+	-219990, -219398, -218806, -218217, -217629, -217042, -216457, -215874,
+	-215292, -214712, -214134, -213557, -212981, -212407, -211835, -211264,
+	-210695, -210127, -209561, -208996, -208433, -207871, -207311, -206752,
+	-206195, -205640, -205086, -204533, -203982, -203432, -202884, -202337,
+	-201792, -201248, -200706, -200165, -199626, -199088, -198551, -198016,
+	-197483, -196950, -196420, -195890, -195363, -194836, -194311, -193787,
+	-193265, -192744, -192225, -191707, -191190, -190675, -190161, -189649,
+	-189138, -188628, -188120, -187613, -187108, -186603, -186100, -185599,
+	-185099, -184600, -184103, -183607, -183112, -182618, -182126, -181635,
+	-181146, -180658, -180171, -179686, -179201, -178718, -178237, -177757,
+	-177278, -176800, -176323, -175848, -175374, -174902, -174430, -173960,
+	-173492, -173024, -172558, -172093, -171629, -171167, -170705, -170245,
+	-169787, -169329, -168873, -168418, -167964, -167511, -167060, -166610,
+	-166161, -165713, -165266, -164821, -164377, -163934, -163492, -163052,
+	-162612, -162174, -161737, -161301, -160867, -160433, -160001, -159570,
+	-159140, -158711, -158283, -157857, -157431, -157007, -156584, -156162,
+	-155741, -155322, -154903, -154486, -154069, -153654, -153240, -152827,
+	-152415, -152005, -151595, -151186, -150779, -150373, -149968, -149563,
+	-149160, -148758, -148358, -147958, -147559, -147161, -146765, -146369,
+	-145975, -145582, -145189, -144798, -144408, -144019, -143631, -143244,
+	-142858, -142473, -142089, -141706, -141324, -140943, -140563, -140185,
+	-139807, -139430, -139054, -138680, -138306, -137933, -137562, -137191,
+	-136821, -136452, -136085, -135718, -135352, -134988, -134624, -134261,
+	-133899, -133538, -133179, -132820, -132462, -132105, -131749, -131394,
+	-131040, -130687, -130335, -129983, -129633, -129284, -128935, -128588,
+	-128241, -127896, -127551, -127207, -126865, -126523, -126182, -125842,
+	-125503, -125165, -124827, -124491, -124155, -123821, -123487, -123154,
+	-122823, -122492, -122161, -121832, -121504, -121177, -120850, -120524,
+	-120200, -119876, -119553, -119231, -118909, -118589, -118269, -117951,
+	-117633, -117316, -117000, -116684, -116370, -116056, -115744, -115432,
+	-115121, -114810, -114501, -114192, -113885, -113578, -113272, -112967,
+	-112662, -112359, -112056, -111754, -111453, -111152, -110853, -110554,
+	-110256, -109959, -109663, -109367, -109073, -108779, -108485, -108193,
+	-107902, -107611, -107321, -107032, -106743, -106456, -106169, -105883,
+	-105597, -105313, -105029, -104746, -104464, -104182, -103901, -103621,
+	-103342, -103064, -102786, -102509, -102233, -101957, -101683, -101409,
+	-101135, -100863, -100591, -100320, -100050, -99780, -99511, -99243,
+	-98975, -98709, -98443, -98178, -97913, -97649, -97386, -97124,
+	-96862, -96601, -96340, -96081, -95822, -95564, -95306, -95049,
+	-94793, -94538, -94283, -94029, -93776, -93523, -93271, -93020,
+	-92769, -92519, -92270, -92021, -91773, -91526, -91279, -91033,
+	-90788, -90543, -90299, -90056, -89813, -89571, -89330, -89089,
+	-88849, -88610, -88371, -88133, -87895, -87658, -87422, -87187,
+	-86952, -86717, -86484, -86251, -86018, -85786, -85555, -85325,
+	-85095, -84865, -84637, -84409, -84181, -83954, -83728, -83502,
+	-83277, -83053, -82829, -82606, -82383, -82161, -81940, -81719,
+	-81499, -81279, -81060, -80842, -80624, -80407, -80190, -79974,
+	-79759, -79544, -79329, -79115, -78902, -78690, -78478, -78266,
+	-78055, -77845, -77635, -77426, -77217, -77009, -76802, -76595,
+	-76388, -76182, -75977, -75772, -75568, -75365, -75162, -74959,
+	-74757, -74556, -74355, -74154, -73954, -73755, -73556, -73358,
+	-73161, -72963, -72767, -72571, -72375, -72180, -71986, -71792,
+	-71598, -71405, -71213, -71021, -70830, -70639, -70448, -70258,
+	-70069, -69880, -69692, -69504, -69317, -69130, -68944, -68758,
+	-68573, -68388, -68204, -68020, -67837, -67654, -67472, -67290,
+	-67108, -66928, -66747, -66567, -66388, -66209, -66031, -65853,
+	-65675, -65498, -65322, -65146, -64970, -64795, -64620, -64446,
+	-64273, -64099, -63927, -63755, -63583, -63411, -63240, -63070,
+	-62900, -62731, -62562, -62393, -62225, -62057, -61890, -61723,
+	-61557, -61391, -61226, -61061, -60896, -60732, -60568, -60405,
+	-60242, -60080, -59918, -59757, -59596, -59435, -59275, -59115,
+	-58956, -58797, -58638, -58480, -58323, -58166, -58009, -57853,
+	-57697, -57541, -57386, -57232, -57077, -56924, -56770, -56617,
+	-56465, -56312, -56161, -56009, -55858, -55708, -55558, -55408,
+	-55259, -55110, -54961, -54813, -54666, -54518, -54371, -54225,
+	-54079, -53933, -53788, -53643, -53498, -53354, -53210, -53067,
+	-52924, -52781, -52639, -52497, -52356, -52215, -52074, -51933,
+	-51794, -51654, -51515, -51376, -51238, -51099, -50962, -50824,
+	-50687, -50551, -50415, -50279, -50143, -50008, -49873, -49739,
+	-49605, -49471, -49338, -49205, -49072, -48940, -48808, -48677,
+	-48546, -48415, -48284, -48154, -48025, -47895, -47766, -47637,
+	-47509, -47381, -47253, -47126, -46999, -46872, -46746, -46620,
+	-46494, -46369, -46244, -46119, -45995, -45871, -45748, -45624,
+	-45501, -45379, -45257, -45135, -45013, -44892, -44771, -44650,
+	-44530, -44410, -44290, -44171, -44052, -43933, -43815, -43697,
+	-43579, -43461, -43344, -43227, -43111, -42995, -42879, -42763,
+	-42648, -42533, -42419, -42304, -42190, -42077, -41963, -41850,
+	-41737, -41625, -41513, -41401, -41289, -41178, -41067, -40956,
+	-40846, -40736, -40626, -40517, -40408, -40299, -40190, -40082,
+	-39974, -39866, -39759, -39651, -39545, -39438, -39332, -39226,
+	-39120, -39015, -38909, -38805, -38700, -38596, -38492, -38388,
+	-38285, -38181, -38079, -37976, -37874, -37772, -37670, -37568,
+	-37467, -37366, -37265, -37165, -37065, -36965, -36865, -36766,
+	-36667, -36568, -36470, -36371, -36273, -36175, -36078, -35981,
+	-35884, -35787, -35691, -35595, -35499, -35403, -35308, -35212,
+	-35118, -35023, -34928, -34834, -34741, -34647, -34554, -34460,
+	-34368, -34275, -34183, -34090, -33999, -33907, -33816, -33724,
+	-33634, -33543, -33453, -33362, -33273, -33183, -33093, -33004,
+	-32915, -32827, -32738, -32650, -32562, -32474, -32387, -32299,
+	-32212, -32126, -32039, -31953, -31867, -31781, -31695, -31610,
+	-31524, -31440, -31355, -31270, -31186, -31102, -31018, -30935,
+	-30851, -30768, -30685, -30603, -30520, -30438, -30356, -30274,
+	-30192, -30111, -30030, -29949, -29868, -29788, -29708, -29627,
+	-29548, -29468, -29389, -29309, -29230, -29152, -29073, -28995,
+	-28917, -28839, -28761, -28683, -28606, -28529, -28452, -28376,
+	-28299, -28223, -28147, -28071, -27995, -27920, -27845, -27770,
+	-27695, -27620, -27546, -27471, -27397, -27324, -27250, -27177,
+	-27103, -27030, -26957, -26885, -26812, -26740, -26668, -26596,
+	-26524, -26453, -26382, -26311, -26240, -26169, -26098, -26028,
+	-25958, -25888, -25818, -25749, -25679, -25610, -25541, -25472,
+	-25404, -25335, -25267, -25199, -25131, -25063, -24996, -24928,
+	-24861, -24794, -24727, -24661, -24594, -24528, -24462, -24396,
+	-24330, -24265, -24199, -24134, -24069, -24004, -23939, -23875,
+	-23811, -23746, -23682, -23619, -23555, -23492, -23428, -23365,
+	-23302, -23239, -23177, -23114, -23052, -22990, -22928, -22866,
+	-22804, -22743, -22682, -22621, -22560, -22499, -22438, -22378,
+	-22317, -22257, -22197, -22138, -22078, -22018, -21959, -21900,
+	-21841, -21782, -21723, -21665, -21606, -21548, -21490, -21432,
+	-21374, -21317, -21259, -21202, -21145, -21088, -21031, -20974,
+	-20918, -20862, -20805, -20749, -20693, -20638, -20582, -20527,
+	-20471, -20416, -20361, -20306, -20251, -20197, -20142, -20088,
+	-20034, -19980, -19926, -19873, -19819, -19766, -19712, -19659,
+	-19606, -19553, -19501, -19448, -19396, -19343, -19291, -19239,
+	-19188, -19136, -19084, -19033, -18982, -18930, -18879, -18828,
+	-18778, -18727, -18677, -18626, -18576, -18526, -18476, -18426,
+	-18377, -18327, -18278, -18229, -18179, -18130, -18082, -18033,
+	-17984, -17936, -17887, -17839, -17791, -17743, -17695, -17648,
+	-17600, -17553, -17505, -17458, -17411, -17364, -17318, -17271,
+	-17224, -17178, -17132, -17085, -17039, -16993, -16948, -16902,
+	-16856, -16811, -16766, -16721, -16676, -16631, -16586, -16541,
+	-16496, -16452, -16408, -16363, -16319, -16275, -16232, -16188,
+	-16144, -16101, -16057, -16014, -15971, -15928, -15885, -15842,
+	-15799, -15757, -15714, -15672, -15630, -15588, -15546, -15504,
+	-15462, -15420, -15379, -15337, -15296, -15255, -15214, -15173,
+	-15132, -15091, -15050, -15010, -14969, -14929, -14889, -14849,
+	-14809, -14769, -14729, -14689, -14650, -14610, -14571, -14532,
+	-14492, -14453, -14414, -14376, -14337, -14298, -14260, -14221,
+	-14183, -14145, -14107, -14069, -14031, -13993, -13955, -13917,
+	-13880, -13843, -13805, -13768, -13731, -13694, -13657, -13620,
+	-13584, -13547, -13510, -13474, -13438, -13402, -13365, -13329,
+	-13293, -13258, -13222, -13186, -13151, -13115, -13080, -13045,
+	-13010, -12975, -12940, -12905, -12870, -12835, -12801, -12766,
+	-12732, -12697, -12663, -12629, -12595, -12561, -12527, -12494,
+	-12460, -12426, -12393, -12359, -12326, -12293, -12260, -12227,
+	-12194, -12161, -12128, -12095, -12063, -12030, -11998, -11966,
+	-11933, -11901, -11869, -11837, -11805, -11773, -11742, -11710,
+	-11678, -11647, -11616, -11584, -11553, -11522, -11491, -11460,
+	-11429, -11398, -11368, -11337, -11306, -11276, -11246, -11215,
+	-11185, -11155, -11125, -11095, -11065, -11035, -11005, -10976,
+	-10946, -10917, -10887, -10858, -10829, -10799, -10770, -10741,
+	-10712, -10683, -10655, -10626, -10597, -10569, -10540, -10512,
+	-10484, -10455, -10427, -10399, -10371, -10343, -10315, -10287,
+	-10260, -10232, -10204, -10177, -10150, -10122, -10095, -10068,
+	-10041, -10014, -9987, -9960, -9933, -9906, -9879, -9853,
+	-9826, -9800, -9773, -9747, -9721, -9694, -9668, -9642,
+	-9616, -9590, -9565, -9539, -9513, -9487, -9462, -9436,
+	-9411, -9386, -9360, -9335, -9310, -9285, -9260, -9235,
+	-9210, -9185, -9160, -9136, -9111, -9086, -9062, -9038,
+	-9013, -8989, -8965, -8941, -8916, -8892, -8868, -8845,
+	-8821, -8797, -8773, -8750, -8726, -8703, -8679, -8656,
+	-8632, -8609, -8586, -8563, -8540, -8517, -8494, -8471,
+	-8448, -8425, -8403, -8380, -8357, -8335, -8312, -8290,
+	-8268, -8245, -8223, -8201, -8179, -8157, -8135, -8113,
+	-8091, -8069, -8047, -8026, -8004, -7983, -7961, -7940,
+	-7918, -7897, -7876, -7854, -7833, -7812, -7791, -7770,
+	-7749, -7728, -7707, -7687, -7666, -7645, -7625, -7604,
+	-7584, -7563, -7543, -7522, -7502, -7482, -7462, -7442,
+	-7422, -7402, -7382, -7362, -7342, -7322, -7302, -7283,
+	-7263, -7244, -7224, -7205, -7185, -7166, -7146, -7127,
+	-7108, -7089, -7070, -7051, -7032, -7013, -6994, -6975,
+	-6956, -6937, -6919, -6900, -6882, -6863, -6845, -6826,
+	-6808, -6789, -6771, -6753, -6735, -6716, -6698, -6680,
+	-6662, -6644, -6626, -6609, -6591, -6573, -6555, -6538,
+	-6520, -6502, -6485, -6467, -6450, -6433, -6415, -6398,
+	-6381, -6364, -6346, -6329, -6312, -6295, -6278, -6261,
+	-6244, -6228, -6211, -6194, -6177, -6161, -6144, -6128,
+	-6111, -6095, -6078, -6062, -6045, -6029, -6013, -5997,
+	-5981, -5964, -5948, -5932, -5916, -5900, -5885, -5869,
+	-5853, -5837, -5821, -5806, -5790, -5774, -5759, -5743,
+	-5728, -5712, -5697, -5682, -5666, -5651, -5636, -5621,
+	-5606, -5590, -5575, -5560, -5545, -5530, -5515, -5501,
+	-5486, -5471, -5456, -5442, -5427, -5412, -5398, -5383,
+	-5369, -5354, -5340, -5325, -5311, -5297, -5282, -5268,
+	-5254, -5240, -5226, -5212, -5198, -5184, -5170, -5156,
+	-5142, -5128, -5114, -5100, -5087, -5073, -5059, -5046,
+	-5032, -5018, -5005, -4991, -4978, -4965, -4951, -4938,
+	-4924, -4911, -4898, -4885, -4872, -4858, -4845, -4832,
+	-4819, -4806, -4793, -4780, -4768, -4755, -4742, -4729,
+	-4716, -4704, -4691, -4678, -4666, -4653, -4641, -4628,
+	-4616, -4603, -4591, -4578, -4566, -4554, -4542, -4529,
+	-4517, -4505, -4493, -4481, -4469, -4457, -4445, -4433,
+	-4421, -4409, -4397, -4385, -4373, -4361, -4350, -4338,
+	-4326, -4315, -4303, -4291, -4280, -4268, -4257, -4245,
+	-4234, -4222, -4211, -4200, -4188, -4177, -4166, -4155,
+	-4143, -4132, -4121, -4110, -4099, -4088, -4077, -4066,
+	-4055, -4044, -4033, -4022, -4011, -4001, -3990, -3979,
+	-3968, -3958, -3947, -3936, -3926, -3915, -3905, -3894,
+	-3884, -3873, -3863, -3852, -3842, -3831, -3821, -3811,
+	-3801, -3790, -3780, -3770, -3760, -3750, -3740, -3729,
+	-3719, -3709, -3699, -3689, -3679, -3670, -3660, -3650,
+	-3640, -3630, -3620, -3611, -3601, -3591, -3581, -3572,
+	-3562, -3553, -3543, -3533, -3524, -3514, -3505, -3496,
+	-3486, -3477, -3467, -3458, -3449, -3439, -3430, -3421,
+	-3412, -3402, -3393, -3384, -3375, -3366, -3357, -3348,
+	-3339, -3330, -3321, -3312, -3303, -3294, -3285, -3276,
+	-3267, -3259, -3250, -3241, -3232, -3224, -3215, -3206,
+	-3198, -3189, -3180, -3172, -3163, -3155, -3146, -3138,
+	-3129, -3121, -3113, -3104, -3096, -3087, -3079, -3071,
+	-3063, -3054, -3046, -3038, -3030, -3022, -3013, -3005,
+	-2997, -2989, -2981, -2973, -2965, -2957, -2949, -2941,
+	-2933, -2925, -2917, -2909, -2902, -2894, -2886, -2878,
+	-2870, -2863, -2855, -2847, -2840, -2832, -2824, -2817,
+	-2809, -2802, -2794, -2787, -2779, -2772, -2764, -2757,
+	-2749, -2742, -2734, -2727, -2720, -2712, -2705, -2698,
+	-2690, -2683, -2676, -2669, -2662, -2654, -2647, -2640,
+	-2633, -2626, -2619, -2612, -2605, -2598, -2591, -2584,
+	-2577, -2570, -2563, -2556, -2549, -2542, -2535, -2529,
+	-2522, -2515, -2508, -2501, -2495, -2488, -2481, -2475,
+	-2468, -2461, -2455, -2448, -2441, -2435, -2428, -2422,
+	-2415, -2409, -2402, -2396, -2389, -2383, -2376, -2370,
+	-2364, -2357, -2351, -2344, -2338, -2332, -2326, -2319,
+	-2313, -2307, -2301, -2294, -2288, -2282, -2276, -2270,
+	-2264, -2258, -2251, -2245, -2239, -2233, -2227, -2221,
+	-2215, -2209, -2203, -2197, -2192, -2186, -2180, -2174,
+	-2168, -2162, -2156, -2150, -2145, -2139, -2133, -2127,
+	-2122, -2116, -2110, -2105, -2099, -2093, -2088, -2082,
+	-2076, -2071, -2065, -2060, -2054, -2049, -2043, -2037,
+	-2032, -2027, -2021, -2016, -2010, -2005, -1999, -1994,
+	-1989, -1983, -1978, -1973, -1967, -1962, -1957, -1951,
+	-1946, -1941, -1936, -1930, -1925, -1920, -1915, -1910,
+	-1905, -1899, -1894, -1889, -1884, -1879, -1874, -1869,
+	-1864, -1859, -1854, -1849, -1844, -1839, -1834, -1829,
+	-1824, -1819, -1814, -1809, -1804, -1800, -1795, -1790,
+	-1785, -1780, -1775, -1771, -1766, -1761, -1756, -1752,
+	-1747, -1742, -1738, -1733, -1728, -1724, -1719, -1714,
+	-1710, -1705, -1700, -1696, -1691, -1687, -1682, -1678,
+	-1673, -1669, -1664, -1660, -1655, -1651, -1646, -1642,
+	-1637, -1633, -1629, -1624, -1620, -1615, -1611, -1607,
+	-1602, -1598, -1594, -1589, -1585, -1581, -1577, -1572,
+	-1568, -1564, -1560, -1556, -1551, -1547, -1543, -1539,
+	-1535, -1531, -1526, -1522, -1518, -1514, -1510, -1506,
+	-1502, -1498, -1494, -1490, -1486, -1482, -1478, -1474,
+	-1470, -1466, -1462, -1458, -1454, -1450, -1446, -1442,
+	-1438, -1435, -1431, -1427, -1423, -1419, -1415, -1411,
+	-1408, -1404, -1400, -1396, -1393, -1389, -1385, -1381,
+	-1378, -1374, -1370, -1366, -1363, -1359, -1355, -1352,
+	-1348, -1345, -1341, -1337, -1334, -1330, -1327, -1323,
+	-1319, -1316, -1312, -1309, -1305, -1302, -1298, -1295,
+	-1291, -1288, -1284, -1281, -1277, -1274, -1270, -1267,
+	-1264, -1260, -1257, -1253, -1250, -1247, -1243, -1240,
+	-1237, -1233, -1230, -1227, -1223, -1220, -1217, -1213,
+	-1210, -1207, -1204, -1200, -1197, -1194, -1191, -1188,
+	-1184, -1181, -1178, -1175, -1172, -1168, -1165, -1162,
+	-1159, -1156, -1153, -1150, -1147, -1143, -1140, -1137,
+	-1134, -1131, -1128, -1125, -1122, -1119, -1116, -1113,
+	-1110, -1107, -1104, -1101, -1098, -1095, -1092, -1089,
+	-1086, -1083, -1080, -1078, -1075, -1072, -1069, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const UINT16 SIN_TABLE[SIN_ENT*4+1] = {
+	4095, 2144, 1887, 1737, 1630, 1548, 1480, 1423, 1373, 1330, 1291, 1255, 1223, 1194, 1166, 1141,
+	1117, 1094, 1073, 1053, 1034, 1016, 999, 982, 967, 952, 937, 923, 910, 897, 884, 872,
+	860, 849, 838, 827, 817, 807, 797, 787, 778, 769, 760, 751, 743, 734, 726, 718,
+	711, 703, 696, 688, 681, 674, 667, 661, 654, 648, 641, 635, 629, 623, 617, 611,
+	605, 599, 594, 588, 583, 578, 572, 567, 562, 557, 552, 547, 542, 538, 533, 528,
+	524, 519, 515, 510, 506, 502, 498, 493, 489, 485, 481, 477, 473, 469, 465, 462,
+	458, 454, 450, 447, 443, 440, 436, 433, 429, 426, 422, 419, 416, 412, 409, 406,
+	403, 400, 396, 393, 390, 387, 384, 381, 378, 375, 372, 370, 367, 364, 361, 358,
+	355, 353, 350, 347, 345, 342, 339, 337, 334, 332, 329, 327, 324, 322, 319, 317,
+	314, 312, 310, 307, 305, 303, 300, 298, 296, 293, 291, 289, 287, 285, 282, 280,
+	278, 276, 274, 272, 270, 268, 266, 264, 262, 260, 258, 256, 254, 252, 250, 248,
+	246, 244, 242, 240, 239, 237, 235, 233, 231, 230, 228, 226, 224, 222, 221, 219,
+	217, 216, 214, 212, 211, 209, 207, 206, 204, 202, 201, 199, 198, 196, 195, 193,
+	191, 190, 188, 187, 185, 184, 182, 181, 180, 178, 177, 175, 174, 172, 171, 170,
+	168, 167, 165, 164, 163, 161, 160, 159, 157, 156, 155, 153, 152, 151, 150, 148,
+	147, 146, 145, 143, 142, 141, 140, 138, 137, 136, 135, 134, 133, 131, 130, 129,
+	128, 127, 126, 125, 123, 122, 121, 120, 119, 118, 117, 116, 115, 114, 113, 112,
+	111, 110, 109, 108, 107, 106, 105, 104, 103, 102, 101, 100, 99, 98, 97, 96,
+	95, 94, 93, 92, 91, 90, 89, 89, 88, 87, 86, 85, 84, 83, 82, 82,
+	81, 80, 79, 78, 77, 77, 76, 75, 74, 73, 73, 72, 71, 70, 69, 69,
+	68, 67, 66, 66, 65, 64, 63, 63, 62, 61, 61, 60, 59, 58, 58, 57,
+	56, 56, 55, 54, 54, 53, 52, 52, 51, 50, 50, 49, 49, 48, 47, 47,
+	46, 45, 45, 44, 44, 43, 43, 42, 41, 41, 40, 40, 39, 39, 38, 37,
+	37, 36, 36, 35, 35, 34, 34, 33, 33, 32, 32, 31, 31, 30, 30, 29,
+	29, 28, 28, 27, 27, 27, 26, 26, 25, 25, 24, 24, 23, 23, 23, 22,
+	22, 21, 21, 21, 20, 20, 19, 19, 19, 18, 18, 18, 17, 17, 17, 16,
+	16, 15, 15, 15, 14, 14, 14, 13, 13, 13, 13, 12, 12, 12, 11, 11,
+	11, 10, 10, 10, 10, 9, 9, 9, 9, 8, 8, 8, 8, 7, 7, 7,
+	7, 6, 6, 6, 6, 6, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4,
+	4, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3,
+	4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6,
+	7, 7, 7, 7, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10,
+	11, 11, 11, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 15, 15, 15,
+	16, 16, 17, 17, 17, 18, 18, 18, 19, 19, 19, 20, 20, 21, 21, 21,
+	22, 22, 23, 23, 23, 24, 24, 25, 25, 26, 26, 27, 27, 27, 28, 28,
+	29, 29, 30, 30, 31, 31, 32, 32, 33, 33, 34, 34, 35, 35, 36, 36,
+	37, 37, 38, 39, 39, 40, 40, 41, 41, 42, 43, 43, 44, 44, 45, 45,
+	46, 47, 47, 48, 49, 49, 50, 50, 51, 52, 52, 53, 54, 54, 55, 56,
+	56, 57, 58, 58, 59, 60, 61, 61, 62, 63, 63, 64, 65, 66, 66, 67,
+	68, 69, 69, 70, 71, 72, 73, 73, 74, 75, 76, 77, 77, 78, 79, 80,
+	81, 82, 82, 83, 84, 85, 86, 87, 88, 89, 89, 90, 91, 92, 93, 94,
+	95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
+	111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 125, 126, 127,
+	128, 129, 130, 131, 133, 134, 135, 136, 137, 138, 140, 141, 142, 143, 145, 146,
+	147, 148, 150, 151, 152, 153, 155, 156, 157, 159, 160, 161, 163, 164, 165, 167,
+	168, 170, 171, 172, 174, 175, 177, 178, 180, 181, 182, 184, 185, 187, 188, 190,
+	191, 193, 195, 196, 198, 199, 201, 202, 204, 206, 207, 209, 211, 212, 214, 216,
+	217, 219, 221, 222, 224, 226, 228, 230, 231, 233, 235, 237, 239, 240, 242, 244,
+	246, 248, 250, 252, 254, 256, 258, 260, 262, 264, 266, 268, 270, 272, 274, 276,
+	278, 280, 282, 285, 287, 289, 291, 293, 296, 298, 300, 303, 305, 307, 310, 312,
+	314, 317, 319, 322, 324, 327, 329, 332, 334, 337, 339, 342, 345, 347, 350, 353,
+	355, 358, 361, 364, 367, 370, 372, 375, 378, 381, 384, 387, 390, 393, 396, 400,
+	403, 406, 409, 412, 416, 419, 422, 426, 429, 433, 436, 440, 443, 447, 450, 454,
+	458, 462, 465, 469, 473, 477, 481, 485, 489, 493, 498, 502, 506, 510, 515, 519,
+	524, 528, 533, 538, 542, 547, 552, 557, 562, 567, 572, 578, 583, 588, 594, 599,
+	605, 611, 617, 623, 629, 635, 641, 648, 654, 661, 667, 674, 681, 688, 696, 703,
+	711, 718, 726, 734, 743, 751, 760, 769, 778, 787, 797, 807, 817, 827, 838, 849,
+	860, 872, 884, 897, 910, 923, 937, 952, 967, 982, 999, 1016, 1034, 1053, 1073, 1094,
+	1117, 1141, 1166, 1194, 1223, 1255, 1291, 1330, 1373, 1423, 1480, 1548, 1630, 1737, 1887, 2144,
+	4095, 10336, 10079, 9929, 9822, 9740, 9672, 9615, 9565, 9522, 9483, 9447, 9415, 9386, 9358, 9333,
+	9309, 9286, 9265, 9245, 9226, 9208, 9191, 9174, 9159, 9144, 9129, 9115, 9102, 9089, 9076, 9064,
+	9052, 9041, 9030, 9019, 9009, 8999, 8989, 8979, 8970, 8961, 8952, 8943, 8935, 8926, 8918, 8910,
+	8903, 8895, 8888, 8880, 8873, 8866, 8859, 8853, 8846, 8840, 8833, 8827, 8821, 8815, 8809, 8803,
+	8797, 8791, 8786, 8780, 8775, 8770, 8764, 8759, 8754, 8749, 8744, 8739, 8734, 8730, 8725, 8720,
+	8716, 8711, 8707, 8702, 8698, 8694, 8690, 8685, 8681, 8677, 8673, 8669, 8665, 8661, 8657, 8654,
+	8650, 8646, 8642, 8639, 8635, 8632, 8628, 8625, 8621, 8618, 8614, 8611, 8608, 8604, 8601, 8598,
+	8595, 8592, 8588, 8585, 8582, 8579, 8576, 8573, 8570, 8567, 8564, 8562, 8559, 8556, 8553, 8550,
+	8547, 8545, 8542, 8539, 8537, 8534, 8531, 8529, 8526, 8524, 8521, 8519, 8516, 8514, 8511, 8509,
+	8506, 8504, 8502, 8499, 8497, 8495, 8492, 8490, 8488, 8485, 8483, 8481, 8479, 8477, 8474, 8472,
+	8470, 8468, 8466, 8464, 8462, 8460, 8458, 8456, 8454, 8452, 8450, 8448, 8446, 8444, 8442, 8440,
+	8438, 8436, 8434, 8432, 8431, 8429, 8427, 8425, 8423, 8422, 8420, 8418, 8416, 8414, 8413, 8411,
+	8409, 8408, 8406, 8404, 8403, 8401, 8399, 8398, 8396, 8394, 8393, 8391, 8390, 8388, 8387, 8385,
+	8383, 8382, 8380, 8379, 8377, 8376, 8374, 8373, 8372, 8370, 8369, 8367, 8366, 8364, 8363, 8362,
+	8360, 8359, 8357, 8356, 8355, 8353, 8352, 8351, 8349, 8348, 8347, 8345, 8344, 8343, 8342, 8340,
+	8339, 8338, 8337, 8335, 8334, 8333, 8332, 8330, 8329, 8328, 8327, 8326, 8325, 8323, 8322, 8321,
+	8320, 8319, 8318, 8317, 8315, 8314, 8313, 8312, 8311, 8310, 8309, 8308, 8307, 8306, 8305, 8304,
+	8303, 8302, 8301, 8300, 8299, 8298, 8297, 8296, 8295, 8294, 8293, 8292, 8291, 8290, 8289, 8288,
+	8287, 8286, 8285, 8284, 8283, 8282, 8281, 8281, 8280, 8279, 8278, 8277, 8276, 8275, 8274, 8274,
+	8273, 8272, 8271, 8270, 8269, 8269, 8268, 8267, 8266, 8265, 8265, 8264, 8263, 8262, 8261, 8261,
+	8260, 8259, 8258, 8258, 8257, 8256, 8255, 8255, 8254, 8253, 8253, 8252, 8251, 8250, 8250, 8249,
+	8248, 8248, 8247, 8246, 8246, 8245, 8244, 8244, 8243, 8242, 8242, 8241, 8241, 8240, 8239, 8239,
+	8238, 8237, 8237, 8236, 8236, 8235, 8235, 8234, 8233, 8233, 8232, 8232, 8231, 8231, 8230, 8229,
+	8229, 8228, 8228, 8227, 8227, 8226, 8226, 8225, 8225, 8224, 8224, 8223, 8223, 8222, 8222, 8221,
+	8221, 8220, 8220, 8219, 8219, 8219, 8218, 8218, 8217, 8217, 8216, 8216, 8215, 8215, 8215, 8214,
+	8214, 8213, 8213, 8213, 8212, 8212, 8211, 8211, 8211, 8210, 8210, 8210, 8209, 8209, 8209, 8208,
+	8208, 8207, 8207, 8207, 8206, 8206, 8206, 8205, 8205, 8205, 8205, 8204, 8204, 8204, 8203, 8203,
+	8203, 8202, 8202, 8202, 8202, 8201, 8201, 8201, 8201, 8200, 8200, 8200, 8200, 8199, 8199, 8199,
+	8199, 8198, 8198, 8198, 8198, 8198, 8197, 8197, 8197, 8197, 8197, 8196, 8196, 8196, 8196, 8196,
+	8196, 8195, 8195, 8195, 8195, 8195, 8195, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8193,
+	8193, 8193, 8193, 8193, 8193, 8193, 8193, 8193, 8193, 8192, 8192, 8192, 8192, 8192, 8192, 8192,
+	8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192,
+	8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192,
+	8192, 8192, 8192, 8192, 8192, 8192, 8192, 8192, 8193, 8193, 8193, 8193, 8193, 8193, 8193, 8193,
+	8193, 8193, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8194, 8195, 8195, 8195, 8195, 8195, 8195,
+	8196, 8196, 8196, 8196, 8196, 8196, 8197, 8197, 8197, 8197, 8197, 8198, 8198, 8198, 8198, 8198,
+	8199, 8199, 8199, 8199, 8200, 8200, 8200, 8200, 8201, 8201, 8201, 8201, 8202, 8202, 8202, 8202,
+	8203, 8203, 8203, 8204, 8204, 8204, 8205, 8205, 8205, 8205, 8206, 8206, 8206, 8207, 8207, 8207,
+	8208, 8208, 8209, 8209, 8209, 8210, 8210, 8210, 8211, 8211, 8211, 8212, 8212, 8213, 8213, 8213,
+	8214, 8214, 8215, 8215, 8215, 8216, 8216, 8217, 8217, 8218, 8218, 8219, 8219, 8219, 8220, 8220,
+	8221, 8221, 8222, 8222, 8223, 8223, 8224, 8224, 8225, 8225, 8226, 8226, 8227, 8227, 8228, 8228,
+	8229, 8229, 8230, 8231, 8231, 8232, 8232, 8233, 8233, 8234, 8235, 8235, 8236, 8236, 8237, 8237,
+	8238, 8239, 8239, 8240, 8241, 8241, 8242, 8242, 8243, 8244, 8244, 8245, 8246, 8246, 8247, 8248,
+	8248, 8249, 8250, 8250, 8251, 8252, 8253, 8253, 8254, 8255, 8255, 8256, 8257, 8258, 8258, 8259,
+	8260, 8261, 8261, 8262, 8263, 8264, 8265, 8265, 8266, 8267, 8268, 8269, 8269, 8270, 8271, 8272,
+	8273, 8274, 8274, 8275, 8276, 8277, 8278, 8279, 8280, 8281, 8281, 8282, 8283, 8284, 8285, 8286,
+	8287, 8288, 8289, 8290, 8291, 8292, 8293, 8294, 8295, 8296, 8297, 8298, 8299, 8300, 8301, 8302,
+	8303, 8304, 8305, 8306, 8307, 8308, 8309, 8310, 8311, 8312, 8313, 8314, 8315, 8317, 8318, 8319,
+	8320, 8321, 8322, 8323, 8325, 8326, 8327, 8328, 8329, 8330, 8332, 8333, 8334, 8335, 8337, 8338,
+	8339, 8340, 8342, 8343, 8344, 8345, 8347, 8348, 8349, 8351, 8352, 8353, 8355, 8356, 8357, 8359,
+	8360, 8362, 8363, 8364, 8366, 8367, 8369, 8370, 8372, 8373, 8374, 8376, 8377, 8379, 8380, 8382,
+	8383, 8385, 8387, 8388, 8390, 8391, 8393, 8394, 8396, 8398, 8399, 8401, 8403, 8404, 8406, 8408,
+	8409, 8411, 8413, 8414, 8416, 8418, 8420, 8422, 8423, 8425, 8427, 8429, 8431, 8432, 8434, 8436,
+	8438, 8440, 8442, 8444, 8446, 8448, 8450, 8452, 8454, 8456, 8458, 8460, 8462, 8464, 8466, 8468,
+	8470, 8472, 8474, 8477, 8479, 8481, 8483, 8485, 8488, 8490, 8492, 8495, 8497, 8499, 8502, 8504,
+	8506, 8509, 8511, 8514, 8516, 8519, 8521, 8524, 8526, 8529, 8531, 8534, 8537, 8539, 8542, 8545,
+	8547, 8550, 8553, 8556, 8559, 8562, 8564, 8567, 8570, 8573, 8576, 8579, 8582, 8585, 8588, 8592,
+	8595, 8598, 8601, 8604, 8608, 8611, 8614, 8618, 8621, 8625, 8628, 8632, 8635, 8639, 8642, 8646,
+	8650, 8654, 8657, 8661, 8665, 8669, 8673, 8677, 8681, 8685, 8690, 8694, 8698, 8702, 8707, 8711,
+	8716, 8720, 8725, 8730, 8734, 8739, 8744, 8749, 8754, 8759, 8764, 8770, 8775, 8780, 8786, 8791,
+	8797, 8803, 8809, 8815, 8821, 8827, 8833, 8840, 8846, 8853, 8859, 8866, 8873, 8880, 8888, 8895,
+	8903, 8910, 8918, 8926, 8935, 8943, 8952, 8961, 8970, 8979, 8989, 8999, 9009, 9019, 9030, 9041,
+	9052, 9064, 9076, 9089, 9102, 9115, 9129, 9144, 9159, 9174, 9191, 9208, 9226, 9245, 9265, 9286,
+	9309, 9333, 9358, 9386, 9415, 9447, 9483, 9522, 9565, 9615, 9672, 9740, 9822, 9929, 10079, 10336,
+	4095, 2144, 1887, 1737, 1630, 1548, 1480, 1423, 1373, 1330, 1291, 1255, 1223, 1194, 1166, 1141,
+	1117, 1094, 1073, 1053, 1034, 1016, 999, 982, 967, 952, 937, 923, 910, 897, 884, 872,
+	860, 849, 838, 827, 817, 807, 797, 787, 778, 769, 760, 751, 743, 734, 726, 718,
+	711, 703, 696, 688, 681, 674, 667, 661, 654, 648, 641, 635, 629, 623, 617, 611,
+	605, 599, 594, 588, 583, 578, 572, 567, 562, 557, 552, 547, 542, 538, 533, 528,
+	524, 519, 515, 510, 506, 502, 498, 493, 489, 485, 481, 477, 473, 469, 465, 462,
+	458, 454, 450, 447, 443, 440, 436, 433, 429, 426, 422, 419, 416, 412, 409, 406,
+	403, 400, 396, 393, 390, 387, 384, 381, 378, 375, 372, 370, 367, 364, 361, 358,
+	355, 353, 350, 347, 345, 342, 339, 337, 334, 332, 329, 327, 324, 322, 319, 317,
+	314, 312, 310, 307, 305, 303, 300, 298, 296, 293, 291, 289, 287, 285, 282, 280,
+	278, 276, 274, 272, 270, 268, 266, 264, 262, 260, 258, 256, 254, 252, 250, 248,
+	246, 244, 242, 240, 239, 237, 235, 233, 231, 230, 228, 226, 224, 222, 221, 219,
+	217, 216, 214, 212, 211, 209, 207, 206, 204, 202, 201, 199, 198, 196, 195, 193,
+	191, 190, 188, 187, 185, 184, 182, 181, 180, 178, 177, 175, 174, 172, 171, 170,
+	168, 167, 165, 164, 163, 161, 160, 159, 157, 156, 155, 153, 152, 151, 150, 148,
+	147, 146, 145, 143, 142, 141, 140, 138, 137, 136, 135, 134, 133, 131, 130, 129,
+	128, 127, 126, 125, 123, 122, 121, 120, 119, 118, 117, 116, 115, 114, 113, 112,
+	111, 110, 109, 108, 107, 106, 105, 104, 103, 102, 101, 100, 99, 98, 97, 96,
+	95, 94, 93, 92, 91, 90, 89, 89, 88, 87, 86, 85, 84, 83, 82, 82,
+	81, 80, 79, 78, 77, 77, 76, 75, 74, 73, 73, 72, 71, 70, 69, 69,
+	68, 67, 66, 66, 65, 64, 63, 63, 62, 61, 61, 60, 59, 58, 58, 57,
+	56, 56, 55, 54, 54, 53, 52, 52, 51, 50, 50, 49, 49, 48, 47, 47,
+	46, 45, 45, 44, 44, 43, 43, 42, 41, 41, 40, 40, 39, 39, 38, 37,
+	37, 36, 36, 35, 35, 34, 34, 33, 33, 32, 32, 31, 31, 30, 30, 29,
+	29, 28, 28, 27, 27, 27, 26, 26, 25, 25, 24, 24, 23, 23, 23, 22,
+	22, 21, 21, 21, 20, 20, 19, 19, 19, 18, 18, 18, 17, 17, 17, 16,
+	16, 15, 15, 15, 14, 14, 14, 13, 13, 13, 13, 12, 12, 12, 11, 11,
+	11, 10, 10, 10, 10, 9, 9, 9, 9, 8, 8, 8, 8, 7, 7, 7,
+	7, 6, 6, 6, 6, 6, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4,
+	4, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3,
+	4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6,
+	7, 7, 7, 7, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10,
+	11, 11, 11, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 15, 15, 15,
+	16, 16, 17, 17, 17, 18, 18, 18, 19, 19, 19, 20, 20, 21, 21, 21,
+	22, 22, 23, 23, 23, 24, 24, 25, 25, 26, 26, 27, 27, 27, 28, 28,
+	29, 29, 30, 30, 31, 31, 32, 32, 33, 33, 34, 34, 35, 35, 36, 36,
+	37, 37, 38, 39, 39, 40, 40, 41, 41, 42, 43, 43, 44, 44, 45, 45,
+	46, 47, 47, 48, 49, 49, 50, 50, 51, 52, 52, 53, 54, 54, 55, 56,
+	56, 57, 58, 58, 59, 60, 61, 61, 62, 63, 63, 64, 65, 66, 66, 67,
+	68, 69, 69, 70, 71, 72, 73, 73, 74, 75, 76, 77, 77, 78, 79, 80,
+	81, 82, 82, 83, 84, 85, 86, 87, 88, 89, 89, 90, 91, 92, 93, 94,
+	95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
+	111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 125, 126, 127,
+	128, 129, 130, 131, 133, 134, 135, 136, 137, 138, 140, 141, 142, 143, 145, 146,
+	147, 148, 150, 151, 152, 153, 155, 156, 157, 159, 160, 161, 163, 164, 165, 167,
+	168, 170, 171, 172, 174, 175, 177, 178, 180, 181, 182, 184, 185, 187, 188, 190,
+	191, 193, 195, 196, 198, 199, 201, 202, 204, 206, 207, 209, 211, 212, 214, 216,
+	217, 219, 221, 222, 224, 226, 228, 230, 231, 233, 235, 237, 239, 240, 242, 244,
+	246, 248, 250, 252, 254, 256, 258, 260, 262, 264, 266, 268, 270, 272, 274, 276,
+	278, 280, 282, 285, 287, 289, 291, 293, 296, 298, 300, 303, 305, 307, 310, 312,
+	314, 317, 319, 322, 324, 327, 329, 332, 334, 337, 339, 342, 345, 347, 350, 353,
+	355, 358, 361, 364, 367, 370, 372, 375, 378, 381, 384, 387, 390, 393, 396, 400,
+	403, 406, 409, 412, 416, 419, 422, 426, 429, 433, 436, 440, 443, 447, 450, 454,
+	458, 462, 465, 469, 473, 477, 481, 485, 489, 493, 498, 502, 506, 510, 515, 519,
+	524, 528, 533, 538, 542, 547, 552, 557, 562, 567, 572, 578, 583, 588, 594, 599,
+	605, 611, 617, 623, 629, 635, 641, 648, 654, 661, 667, 674, 681, 688, 696, 703,
+	711, 718, 726, 734, 743, 751, 760, 769, 778, 787, 797, 807, 817, 827, 838, 849,
+	860, 872, 884, 897, 910, 923, 937, 952, 967, 982, 999, 1016, 1034, 1053, 1073, 1094,
+	1117, 1141, 1166, 1194, 1223, 1255, 1291, 1330, 1373, 1423, 1480, 1548, 1630, 1737, 1887, 2144,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4095, 2144, 1887, 1737, 1630, 1548, 1480, 1423, 1373, 1330, 1291, 1255, 1223, 1194, 1166, 1141,
+	1117, 1094, 1073, 1053, 1034, 1016, 999, 982, 967, 952, 937, 923, 910, 897, 884, 872,
+	860, 849, 838, 827, 817, 807, 797, 787, 778, 769, 760, 751, 743, 734, 726, 718,
+	711, 703, 696, 688, 681, 674, 667, 661, 654, 648, 641, 635, 629, 623, 617, 611,
+	605, 599, 594, 588, 583, 578, 572, 567, 562, 557, 552, 547, 542, 538, 533, 528,
+	524, 519, 515, 510, 506, 502, 498, 493, 489, 485, 481, 477, 473, 469, 465, 462,
+	458, 454, 450, 447, 443, 440, 436, 433, 429, 426, 422, 419, 416, 412, 409, 406,
+	403, 400, 396, 393, 390, 387, 384, 381, 378, 375, 372, 370, 367, 364, 361, 358,
+	355, 353, 350, 347, 345, 342, 339, 337, 334, 332, 329, 327, 324, 322, 319, 317,
+	314, 312, 310, 307, 305, 303, 300, 298, 296, 293, 291, 289, 287, 285, 282, 280,
+	278, 276, 274, 272, 270, 268, 266, 264, 262, 260, 258, 256, 254, 252, 250, 248,
+	246, 244, 242, 240, 239, 237, 235, 233, 231, 230, 228, 226, 224, 222, 221, 219,
+	217, 216, 214, 212, 211, 209, 207, 206, 204, 202, 201, 199, 198, 196, 195, 193,
+	191, 190, 188, 187, 185, 184, 182, 181, 180, 178, 177, 175, 174, 172, 171, 170,
+	168, 167, 165, 164, 163, 161, 160, 159, 157, 156, 155, 153, 152, 151, 150, 148,
+	147, 146, 145, 143, 142, 141, 140, 138, 137, 136, 135, 134, 133, 131, 130, 129,
+	128, 127, 126, 125, 123, 122, 121, 120, 119, 118, 117, 116, 115, 114, 113, 112,
+	111, 110, 109, 108, 107, 106, 105, 104, 103, 102, 101, 100, 99, 98, 97, 96,
+	95, 94, 93, 92, 91, 90, 89, 89, 88, 87, 86, 85, 84, 83, 82, 82,
+	81, 80, 79, 78, 77, 77, 76, 75, 74, 73, 73, 72, 71, 70, 69, 69,
+	68, 67, 66, 66, 65, 64, 63, 63, 62, 61, 61, 60, 59, 58, 58, 57,
+	56, 56, 55, 54, 54, 53, 52, 52, 51, 50, 50, 49, 49, 48, 47, 47,
+	46, 45, 45, 44, 44, 43, 43, 42, 41, 41, 40, 40, 39, 39, 38, 37,
+	37, 36, 36, 35, 35, 34, 34, 33, 33, 32, 32, 31, 31, 30, 30, 29,
+	29, 28, 28, 27, 27, 27, 26, 26, 25, 25, 24, 24, 23, 23, 23, 22,
+	22, 21, 21, 21, 20, 20, 19, 19, 19, 18, 18, 18, 17, 17, 17, 16,
+	16, 15, 15, 15, 14, 14, 14, 13, 13, 13, 13, 12, 12, 12, 11, 11,
+	11, 10, 10, 10, 10, 9, 9, 9, 9, 8, 8, 8, 8, 7, 7, 7,
+	7, 6, 6, 6, 6, 6, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4,
+	4, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3,
+	4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6,
+	7, 7, 7, 7, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10,
+	11, 11, 11, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 15, 15, 15,
+	16, 16, 17, 17, 17, 18, 18, 18, 19, 19, 19, 20, 20, 21, 21, 21,
+	22, 22, 23, 23, 23, 24, 24, 25, 25, 26, 26, 27, 27, 27, 28, 28,
+	29, 29, 30, 30, 31, 31, 32, 32, 33, 33, 34, 34, 35, 35, 36, 36,
+	37, 37, 38, 39, 39, 40, 40, 41, 41, 42, 43, 43, 44, 44, 45, 45,
+	46, 47, 47, 48, 49, 49, 50, 50, 51, 52, 52, 53, 54, 54, 55, 56,
+	56, 57, 58, 58, 59, 60, 61, 61, 62, 63, 63, 64, 65, 66, 66, 67,
+	68, 69, 69, 70, 71, 72, 73, 73, 74, 75, 76, 77, 77, 78, 79, 80,
+	81, 82, 82, 83, 84, 85, 86, 87, 88, 89, 89, 90, 91, 92, 93, 94,
+	95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
+	111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 125, 126, 127,
+	128, 129, 130, 131, 133, 134, 135, 136, 137, 138, 140, 141, 142, 143, 145, 146,
+	147, 148, 150, 151, 152, 153, 155, 156, 157, 159, 160, 161, 163, 164, 165, 167,
+	168, 170, 171, 172, 174, 175, 177, 178, 180, 181, 182, 184, 185, 187, 188, 190,
+	191, 193, 195, 196, 198, 199, 201, 202, 204, 206, 207, 209, 211, 212, 214, 216,
+	217, 219, 221, 222, 224, 226, 228, 230, 231, 233, 235, 237, 239, 240, 242, 244,
+	246, 248, 250, 252, 254, 256, 258, 260, 262, 264, 266, 268, 270, 272, 274, 276,
+	278, 280, 282, 285, 287, 289, 291, 293, 296, 298, 300, 303, 305, 307, 310, 312,
+	314, 317, 319, 322, 324, 327, 329, 332, 334, 337, 339, 342, 345, 347, 350, 353,
+	355, 358, 361, 364, 367, 370, 372, 375, 378, 381, 384, 387, 390, 393, 396, 400,
+	403, 406, 409, 412, 416, 419, 422, 426, 429, 433, 436, 440, 443, 447, 450, 454,
+	458, 462, 465, 469, 473, 477, 481, 485, 489, 493, 498, 502, 506, 510, 515, 519,
+	524, 528, 533, 538, 542, 547, 552, 557, 562, 567, 572, 578, 583, 588, 594, 599,
+	605, 611, 617, 623, 629, 635, 641, 648, 654, 661, 667, 674, 681, 688, 696, 703,
+	711, 718, 726, 734, 743, 751, 760, 769, 778, 787, 797, 807, 817, 827, 838, 849,
+	860, 872, 884, 897, 910, 923, 937, 952, 967, 982, 999, 1016, 1034, 1053, 1073, 1094,
+	1117, 1141, 1166, 1194, 1223, 1255, 1291, 1330, 1373, 1423, 1480, 1548, 1630, 1737, 1887, 2144,
+	4095, 2144, 1887, 1737, 1630, 1548, 1480, 1423, 1373, 1330, 1291, 1255, 1223, 1194, 1166, 1141,
+	1117, 1094, 1073, 1053, 1034, 1016, 999, 982, 967, 952, 937, 923, 910, 897, 884, 872,
+	860, 849, 838, 827, 817, 807, 797, 787, 778, 769, 760, 751, 743, 734, 726, 718,
+	711, 703, 696, 688, 681, 674, 667, 661, 654, 648, 641, 635, 629, 623, 617, 611,
+	605, 599, 594, 588, 583, 578, 572, 567, 562, 557, 552, 547, 542, 538, 533, 528,
+	524, 519, 515, 510, 506, 502, 498, 493, 489, 485, 481, 477, 473, 469, 465, 462,
+	458, 454, 450, 447, 443, 440, 436, 433, 429, 426, 422, 419, 416, 412, 409, 406,
+	403, 400, 396, 393, 390, 387, 384, 381, 378, 375, 372, 370, 367, 364, 361, 358,
+	355, 353, 350, 347, 345, 342, 339, 337, 334, 332, 329, 327, 324, 322, 319, 317,
+	314, 312, 310, 307, 305, 303, 300, 298, 296, 293, 291, 289, 287, 285, 282, 280,
+	278, 276, 274, 272, 270, 268, 266, 264, 262, 260, 258, 256, 254, 252, 250, 248,
+	246, 244, 242, 240, 239, 237, 235, 233, 231, 230, 228, 226, 224, 222, 221, 219,
+	217, 216, 214, 212, 211, 209, 207, 206, 204, 202, 201, 199, 198, 196, 195, 193,
+	191, 190, 188, 187, 185, 184, 182, 181, 180, 178, 177, 175, 174, 172, 171, 170,
+	168, 167, 165, 164, 163, 161, 160, 159, 157, 156, 155, 153, 152, 151, 150, 148,
+	147, 146, 145, 143, 142, 141, 140, 138, 137, 136, 135, 134, 133, 131, 130, 129,
+	128, 127, 126, 125, 123, 122, 121, 120, 119, 118, 117, 116, 115, 114, 113, 112,
+	111, 110, 109, 108, 107, 106, 105, 104, 103, 102, 101, 100, 99, 98, 97, 96,
+	95, 94, 93, 92, 91, 90, 89, 89, 88, 87, 86, 85, 84, 83, 82, 82,
+	81, 80, 79, 78, 77, 77, 76, 75, 74, 73, 73, 72, 71, 70, 69, 69,
+	68, 67, 66, 66, 65, 64, 63, 63, 62, 61, 61, 60, 59, 58, 58, 57,
+	56, 56, 55, 54, 54, 53, 52, 52, 51, 50, 50, 49, 49, 48, 47, 47,
+	46, 45, 45, 44, 44, 43, 43, 42, 41, 41, 40, 40, 39, 39, 38, 37,
+	37, 36, 36, 35, 35, 34, 34, 33, 33, 32, 32, 31, 31, 30, 30, 29,
+	29, 28, 28, 27, 27, 27, 26, 26, 25, 25, 24, 24, 23, 23, 23, 22,
+	22, 21, 21, 21, 20, 20, 19, 19, 19, 18, 18, 18, 17, 17, 17, 16,
+	16, 15, 15, 15, 14, 14, 14, 13, 13, 13, 13, 12, 12, 12, 11, 11,
+	11, 10, 10, 10, 10, 9, 9, 9, 9, 8, 8, 8, 8, 7, 7, 7,
+	7, 6, 6, 6, 6, 6, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4,
+	4, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3,
+	4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6,
+	7, 7, 7, 7, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 10,
+	11, 11, 11, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 15, 15, 15,
+	16, 16, 17, 17, 17, 18, 18, 18, 19, 19, 19, 20, 20, 21, 21, 21,
+	22, 22, 23, 23, 23, 24, 24, 25, 25, 26, 26, 27, 27, 27, 28, 28,
+	29, 29, 30, 30, 31, 31, 32, 32, 33, 33, 34, 34, 35, 35, 36, 36,
+	37, 37, 38, 39, 39, 40, 40, 41, 41, 42, 43, 43, 44, 44, 45, 45,
+	46, 47, 47, 48, 49, 49, 50, 50, 51, 52, 52, 53, 54, 54, 55, 56,
+	56, 57, 58, 58, 59, 60, 61, 61, 62, 63, 63, 64, 65, 66, 66, 67,
+	68, 69, 69, 70, 71, 72, 73, 73, 74, 75, 76, 77, 77, 78, 79, 80,
+	81, 82, 82, 83, 84, 85, 86, 87, 88, 89, 89, 90, 91, 92, 93, 94,
+	95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
+	111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 125, 126, 127,
+	128, 129, 130, 131, 133, 134, 135, 136, 137, 138, 140, 141, 142, 143, 145, 146,
+	147, 148, 150, 151, 152, 153, 155, 156, 157, 159, 160, 161, 163, 164, 165, 167,
+	168, 170, 171, 172, 174, 175, 177, 178, 180, 181, 182, 184, 185, 187, 188, 190,
+	191, 193, 195, 196, 198, 199, 201, 202, 204, 206, 207, 209, 211, 212, 214, 216,
+	217, 219, 221, 222, 224, 226, 228, 230, 231, 233, 235, 237, 239, 240, 242, 244,
+	246, 248, 250, 252, 254, 256, 258, 260, 262, 264, 266, 268, 270, 272, 274, 276,
+	278, 280, 282, 285, 287, 289, 291, 293, 296, 298, 300, 303, 305, 307, 310, 312,
+	314, 317, 319, 322, 324, 327, 329, 332, 334, 337, 339, 342, 345, 347, 350, 353,
+	355, 358, 361, 364, 367, 370, 372, 375, 378, 381, 384, 387, 390, 393, 396, 400,
+	403, 406, 409, 412, 416, 419, 422, 426, 429, 433, 436, 440, 443, 447, 450, 454,
+	458, 462, 465, 469, 473, 477, 481, 485, 489, 493, 498, 502, 506, 510, 515, 519,
+	524, 528, 533, 538, 542, 547, 552, 557, 562, 567, 572, 578, 583, 588, 594, 599,
+	605, 611, 617, 623, 629, 635, 641, 648, 654, 661, 667, 674, 681, 688, 696, 703,
+	711, 718, 726, 734, 743, 751, 760, 769, 778, 787, 797, 807, 817, 827, 838, 849,
+	860, 872, 884, 897, 910, 923, 937, 952, 967, 982, 999, 1016, 1034, 1053, 1073, 1094,
+	1117, 1141, 1166, 1194, 1223, 1255, 1291, 1330, 1373, 1423, 1480, 1548, 1630, 1737, 1887, 2144,
+	4095, 2144, 1887, 1737, 1630, 1548, 1480, 1423, 1373, 1330, 1291, 1255, 1223, 1194, 1166, 1141,
+	1117, 1094, 1073, 1053, 1034, 1016, 999, 982, 967, 952, 937, 923, 910, 897, 884, 872,
+	860, 849, 838, 827, 817, 807, 797, 787, 778, 769, 760, 751, 743, 734, 726, 718,
+	711, 703, 696, 688, 681, 674, 667, 661, 654, 648, 641, 635, 629, 623, 617, 611,
+	605, 599, 594, 588, 583, 578, 572, 567, 562, 557, 552, 547, 542, 538, 533, 528,
+	524, 519, 515, 510, 506, 502, 498, 493, 489, 485, 481, 477, 473, 469, 465, 462,
+	458, 454, 450, 447, 443, 440, 436, 433, 429, 426, 422, 419, 416, 412, 409, 406,
+	403, 400, 396, 393, 390, 387, 384, 381, 378, 375, 372, 370, 367, 364, 361, 358,
+	355, 353, 350, 347, 345, 342, 339, 337, 334, 332, 329, 327, 324, 322, 319, 317,
+	314, 312, 310, 307, 305, 303, 300, 298, 296, 293, 291, 289, 287, 285, 282, 280,
+	278, 276, 274, 272, 270, 268, 266, 264, 262, 260, 258, 256, 254, 252, 250, 248,
+	246, 244, 242, 240, 239, 237, 235, 233, 231, 230, 228, 226, 224, 222, 221, 219,
+	217, 216, 214, 212, 211, 209, 207, 206, 204, 202, 201, 199, 198, 196, 195, 193,
+	191, 190, 188, 187, 185, 184, 182, 181, 180, 178, 177, 175, 174, 172, 171, 170,
+	168, 167, 165, 164, 163, 161, 160, 159, 157, 156, 155, 153, 152, 151, 150, 148,
+	147, 146, 145, 143, 142, 141, 140, 138, 137, 136, 135, 134, 133, 131, 130, 129,
+	128, 127, 126, 125, 123, 122, 121, 120, 119, 118, 117, 116, 115, 114, 113, 112,
+	111, 110, 109, 108, 107, 106, 105, 104, 103, 102, 101, 100, 99, 98, 97, 96,
+	95, 94, 93, 92, 91, 90, 89, 89, 88, 87, 86, 85, 84, 83, 82, 82,
+	81, 80, 79, 78, 77, 77, 76, 75, 74, 73, 73, 72, 71, 70, 69, 69,
+	68, 67, 66, 66, 65, 64, 63, 63, 62, 61, 61, 60, 59, 58, 58, 57,
+	56, 56, 55, 54, 54, 53, 52, 52, 51, 50, 50, 49, 49, 48, 47, 47,
+	46, 45, 45, 44, 44, 43, 43, 42, 41, 41, 40, 40, 39, 39, 38, 37,
+	37, 36, 36, 35, 35, 34, 34, 33, 33, 32, 32, 31, 31, 30, 30, 29,
+	29, 28, 28, 27, 27, 27, 26, 26, 25, 25, 24, 24, 23, 23, 23, 22,
+	22, 21, 21, 21, 20, 20, 19, 19, 19, 18, 18, 18, 17, 17, 17, 16,
+	16, 15, 15, 15, 14, 14, 14, 13, 13, 13, 13, 12, 12, 12, 11, 11,
+	11, 10, 10, 10, 10, 9, 9, 9, 9, 8, 8, 8, 8, 7, 7, 7,
+	7, 6, 6, 6, 6, 6, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4,
+	4, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4095, 2144, 1887, 1737, 1630, 1548, 1480, 1423, 1373, 1330, 1291, 1255, 1223, 1194, 1166, 1141,
+	1117, 1094, 1073, 1053, 1034, 1016, 999, 982, 967, 952, 937, 923, 910, 897, 884, 872,
+	860, 849, 838, 827, 817, 807, 797, 787, 778, 769, 760, 751, 743, 734, 726, 718,
+	711, 703, 696, 688, 681, 674, 667, 661, 654, 648, 641, 635, 629, 623, 617, 611,
+	605, 599, 594, 588, 583, 578, 572, 567, 562, 557, 552, 547, 542, 538, 533, 528,
+	524, 519, 515, 510, 506, 502, 498, 493, 489, 485, 481, 477, 473, 469, 465, 462,
+	458, 454, 450, 447, 443, 440, 436, 433, 429, 426, 422, 419, 416, 412, 409, 406,
+	403, 400, 396, 393, 390, 387, 384, 381, 378, 375, 372, 370, 367, 364, 361, 358,
+	355, 353, 350, 347, 345, 342, 339, 337, 334, 332, 329, 327, 324, 322, 319, 317,
+	314, 312, 310, 307, 305, 303, 300, 298, 296, 293, 291, 289, 287, 285, 282, 280,
+	278, 276, 274, 272, 270, 268, 266, 264, 262, 260, 258, 256, 254, 252, 250, 248,
+	246, 244, 242, 240, 239, 237, 235, 233, 231, 230, 228, 226, 224, 222, 221, 219,
+	217, 216, 214, 212, 211, 209, 207, 206, 204, 202, 201, 199, 198, 196, 195, 193,
+	191, 190, 188, 187, 185, 184, 182, 181, 180, 178, 177, 175, 174, 172, 171, 170,
+	168, 167, 165, 164, 163, 161, 160, 159, 157, 156, 155, 153, 152, 151, 150, 148,
+	147, 146, 145, 143, 142, 141, 140, 138, 137, 136, 135, 134, 133, 131, 130, 129,
+	128, 127, 126, 125, 123, 122, 121, 120, 119, 118, 117, 116, 115, 114, 113, 112,
+	111, 110, 109, 108, 107, 106, 105, 104, 103, 102, 101, 100, 99, 98, 97, 96,
+	95, 94, 93, 92, 91, 90, 89, 89, 88, 87, 86, 85, 84, 83, 82, 82,
+	81, 80, 79, 78, 77, 77, 76, 75, 74, 73, 73, 72, 71, 70, 69, 69,
+	68, 67, 66, 66, 65, 64, 63, 63, 62, 61, 61, 60, 59, 58, 58, 57,
+	56, 56, 55, 54, 54, 53, 52, 52, 51, 50, 50, 49, 49, 48, 47, 47,
+	46, 45, 45, 44, 44, 43, 43, 42, 41, 41, 40, 40, 39, 39, 38, 37,
+	37, 36, 36, 35, 35, 34, 34, 33, 33, 32, 32, 31, 31, 30, 30, 29,
+	29, 28, 28, 27, 27, 27, 26, 26, 25, 25, 24, 24, 23, 23, 23, 22,
+	22, 21, 21, 21, 20, 20, 19, 19, 19, 18, 18, 18, 17, 17, 17, 16,
+	16, 15, 15, 15, 14, 14, 14, 13, 13, 13, 13, 12, 12, 12, 11, 11,
+	11, 10, 10, 10, 10, 9, 9, 9, 9, 8, 8, 8, 8, 7, 7, 7,
+	7, 6, 6, 6, 6, 6, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4,
+	4, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+	0,
+};
+
+static const UINT16 ENV_CURVE[2*EG_ENT+2] = {
+	4088, 4080, 4072, 4064, 4056, 4048, 4040, 4032, 4024, 4016, 4008, 4000, 3993, 3985, 3977, 3969,
+	3961, 3954, 3946, 3938, 3930, 3923, 3915, 3907, 3900, 3892, 3884, 3877, 3869, 3862, 3854, 3846,
+	3839, 3831, 3824, 3816, 3809, 3801, 3794, 3786, 3779, 3771, 3764, 3756, 3749, 3742, 3734, 3727,
+	3720, 3712, 3705, 3698, 3690, 3683, 3676, 3668, 3661, 3654, 3647, 3639, 3632, 3625, 3618, 3611,
+	3603, 3596, 3589, 3582, 3575, 3568, 3561, 3554, 3547, 3540, 3533, 3526, 3519, 3512, 3505, 3498,
+	3491, 3484, 3477, 3470, 3463, 3456, 3449, 3442, 3435, 3429, 3422, 3415, 3408, 3401, 3394, 3388,
+	3381, 3374, 3367, 3361, 3354, 3347, 3340, 3334, 3327, 3320, 3314, 3307, 3301, 3294, 3287, 3281,
+	3274, 3268, 3261, 3254, 3248, 3241, 3235, 3228, 3222, 3215, 3209, 3202, 3196, 3190, 3183, 3177,
+	3170, 3164, 3158, 3151, 3145, 3139, 3132, 3126, 3120, 3113, 3107, 3101, 3094, 3088, 3082, 3076,
+	3069, 3063, 3057, 3051, 3045, 3039, 3032, 3026, 3020, 3014, 3008, 3002, 2996, 2990, 2984, 2977,
+	2971, 2965, 2959, 2953, 2947, 2941, 2935, 2929, 2923, 2917, 2912, 2906, 2900, 2894, 2888, 2882,
+	2876, 2870, 2864, 2859, 2853, 2847, 2841, 2835, 2829, 2824, 2818, 2812, 2806, 2801, 2795, 2789,
+	2783, 2778, 2772, 2766, 2761, 2755, 2749, 2744, 2738, 2733, 2727, 2721, 2716, 2710, 2705, 2699,
+	2693, 2688, 2682, 2677, 2671, 2666, 2660, 2655, 2649, 2644, 2639, 2633, 2628, 2622, 2617, 2611,
+	2606, 2601, 2595, 2590, 2585, 2579, 2574, 2569, 2563, 2558, 2553, 2547, 2542, 2537, 2532, 2526,
+	2521, 2516, 2511, 2505, 2500, 2495, 2490, 2485, 2480, 2474, 2469, 2464, 2459, 2454, 2449, 2444,
+	2439, 2433, 2428, 2423, 2418, 2413, 2408, 2403, 2398, 2393, 2388, 2383, 2378, 2373, 2368, 2363,
+	2358, 2353, 2349, 2344, 2339, 2334, 2329, 2324, 2319, 2314, 2310, 2305, 2300, 2295, 2290, 2285,
+	2281, 2276, 2271, 2266, 2261, 2257, 2252, 2247, 2243, 2238, 2233, 2228, 2224, 2219, 2214, 2210,
+	2205, 2200, 2196, 2191, 2186, 2182, 2177, 2173, 2168, 2163, 2159, 2154, 2150, 2145, 2141, 2136,
+	2132, 2127, 2123, 2118, 2114, 2109, 2105, 2100, 2096, 2091, 2087, 2082, 2078, 2074, 2069, 2065,
+	2060, 2056, 2052, 2047, 2043, 2039, 2034, 2030, 2026, 2021, 2017, 2013, 2008, 2004, 2000, 1996,
+	1991, 1987, 1983, 1979, 1974, 1970, 1966, 1962, 1957, 1953, 1949, 1945, 1941, 1937, 1932, 1928,
+	1924, 1920, 1916, 1912, 1908, 1904, 1900, 1895, 1891, 1887, 1883, 1879, 1875, 1871, 1867, 1863,
+	1859, 1855, 1851, 1847, 1843, 1839, 1835, 1831, 1827, 1823, 1819, 1815, 1811, 1808, 1804, 1800,
+	1796, 1792, 1788, 1784, 1780, 1777, 1773, 1769, 1765, 1761, 1757, 1754, 1750, 1746, 1742, 1738,
+	1735, 1731, 1727, 1723, 1720, 1716, 1712, 1708, 1705, 1701, 1697, 1694, 1690, 1686, 1682, 1679,
+	1675, 1671, 1668, 1664, 1661, 1657, 1653, 1650, 1646, 1642, 1639, 1635, 1632, 1628, 1625, 1621,
+	1617, 1614, 1610, 1607, 1603, 1600, 1596, 1593, 1589, 1586, 1582, 1579, 1575, 1572, 1568, 1565,
+	1562, 1558, 1555, 1551, 1548, 1544, 1541, 1538, 1534, 1531, 1527, 1524, 1521, 1517, 1514, 1511,
+	1507, 1504, 1501, 1497, 1494, 1491, 1487, 1484, 1481, 1478, 1474, 1471, 1468, 1464, 1461, 1458,
+	1455, 1452, 1448, 1445, 1442, 1439, 1435, 1432, 1429, 1426, 1423, 1420, 1416, 1413, 1410, 1407,
+	1404, 1401, 1398, 1394, 1391, 1388, 1385, 1382, 1379, 1376, 1373, 1370, 1367, 1364, 1360, 1357,
+	1354, 1351, 1348, 1345, 1342, 1339, 1336, 1333, 1330, 1327, 1324, 1321, 1318, 1315, 1312, 1309,
+	1307, 1304, 1301, 1298, 1295, 1292, 1289, 1286, 1283, 1280, 1277, 1274, 1272, 1269, 1266, 1263,
+	1260, 1257, 1254, 1252, 1249, 1246, 1243, 1240, 1238, 1235, 1232, 1229, 1226, 1224, 1221, 1218,
+	1215, 1212, 1210, 1207, 1204, 1201, 1199, 1196, 1193, 1191, 1188, 1185, 1182, 1180, 1177, 1174,
+	1172, 1169, 1166, 1164, 1161, 1158, 1156, 1153, 1150, 1148, 1145, 1143, 1140, 1137, 1135, 1132,
+	1130, 1127, 1124, 1122, 1119, 1117, 1114, 1112, 1109, 1106, 1104, 1101, 1099, 1096, 1094, 1091,
+	1089, 1086, 1084, 1081, 1079, 1076, 1074, 1071, 1069, 1066, 1064, 1061, 1059, 1057, 1054, 1052,
+	1049, 1047, 1044, 1042, 1040, 1037, 1035, 1032, 1030, 1028, 1025, 1023, 1020, 1018, 1016, 1013,
+	1011, 1009, 1006, 1004, 1002, 999, 997, 995, 992, 990, 988, 985, 983, 981, 978, 976,
+	974, 972, 969, 967, 965, 963, 960, 958, 956, 954, 951, 949, 947, 945, 942, 940,
+	938, 936, 934, 931, 929, 927, 925, 923, 921, 918, 916, 914, 912, 910, 908, 905,
+	903, 901, 899, 897, 895, 893, 891, 889, 886, 884, 882, 880, 878, 876, 874, 872,
+	870, 868, 866, 864, 862, 860, 858, 855, 853, 851, 849, 847, 845, 843, 841, 839,
+	837, 835, 833, 831, 829, 827, 825, 823, 822, 820, 818, 816, 814, 812, 810, 808,
+	806, 804, 802, 800, 798, 796, 794, 793, 791, 789, 787, 785, 783, 781, 779, 777,
+	776, 774, 772, 770, 768, 766, 764, 763, 761, 759, 757, 755, 753, 752, 750, 748,
+	746, 744, 743, 741, 739, 737, 735, 734, 732, 730, 728, 727, 725, 723, 721, 720,
+	718, 716, 714, 713, 711, 709, 707, 706, 704, 702, 701, 699, 697, 695, 694, 692,
+	690, 689, 687, 685, 684, 682, 680, 679, 677, 675, 674, 672, 670, 669, 667, 666,
+	664, 662, 661, 659, 657, 656, 654, 653, 651, 649, 648, 646, 645, 643, 641, 640,
+	638, 637, 635, 634, 632, 630, 629, 627, 626, 624, 623, 621, 620, 618, 617, 615,
+	614, 612, 610, 609, 607, 606, 604, 603, 601, 600, 598, 597, 596, 594, 593, 591,
+	590, 588, 587, 585, 584, 582, 581, 579, 578, 577, 575, 574, 572, 571, 569, 568,
+	567, 565, 564, 562, 561, 559, 558, 557, 555, 554, 552, 551, 550, 548, 547, 546,
+	544, 543, 541, 540, 539, 537, 536, 535, 533, 532, 531, 529, 528, 527, 525, 524,
+	523, 521, 520, 519, 517, 516, 515, 514, 512, 511, 510, 508, 507, 506, 504, 503,
+	502, 501, 499, 498, 497, 496, 494, 493, 492, 491, 489, 488, 487, 486, 484, 483,
+	482, 481, 479, 478, 477, 476, 475, 473, 472, 471, 470, 468, 467, 466, 465, 464,
+	463, 461, 460, 459, 458, 457, 455, 454, 453, 452, 451, 450, 448, 447, 446, 445,
+	444, 443, 442, 440, 439, 438, 437, 436, 435, 434, 433, 431, 430, 429, 428, 427,
+	426, 425, 424, 423, 421, 420, 419, 418, 417, 416, 415, 414, 413, 412, 411, 410,
+	408, 407, 406, 405, 404, 403, 402, 401, 400, 399, 398, 397, 396, 395, 394, 393,
+	392, 391, 390, 389, 388, 387, 386, 385, 384, 383, 382, 381, 380, 379, 378, 377,
+	376, 375, 374, 373, 372, 371, 370, 369, 368, 367, 366, 365, 364, 363, 362, 361,
+	360, 359, 358, 357, 356, 355, 354, 353, 353, 352, 351, 350, 349, 348, 347, 346,
+	345, 344, 343, 342, 341, 341, 340, 339, 338, 337, 336, 335, 334, 333, 332, 332,
+	331, 330, 329, 328, 327, 326, 325, 324, 324, 323, 322, 321, 320, 319, 318, 318,
+	317, 316, 315, 314, 313, 312, 312, 311, 310, 309, 308, 307, 307, 306, 305, 304,
+	303, 303, 302, 301, 300, 299, 298, 298, 297, 296, 295, 294, 294, 293, 292, 291,
+	290, 290, 289, 288, 287, 287, 286, 285, 284, 283, 283, 282, 281, 280, 280, 279,
+	278, 277, 277, 276, 275, 274, 273, 273, 272, 271, 271, 270, 269, 268, 268, 267,
+	266, 265, 265, 264, 263, 262, 262, 261, 260, 260, 259, 258, 257, 257, 256, 255,
+	255, 254, 253, 252, 252, 251, 250, 250, 249, 248, 248, 247, 246, 246, 245, 244,
+	244, 243, 242, 241, 241, 240, 239, 239, 238, 237, 237, 236, 235, 235, 234, 234,
+	233, 232, 232, 231, 230, 230, 229, 228, 228, 227, 226, 226, 225, 225, 224, 223,
+	223, 222, 221, 221, 220, 220, 219, 218, 218, 217, 216, 216, 215, 215, 214, 213,
+	213, 212, 212, 211, 210, 210, 209, 209, 208, 207, 207, 206, 206, 205, 205, 204,
+	203, 203, 202, 202, 201, 200, 200, 199, 199, 198, 198, 197, 196, 196, 195, 195,
+	194, 194, 193, 193, 192, 191, 191, 190, 190, 189, 189, 188, 188, 187, 187, 186,
+	186, 185, 184, 184, 183, 183, 182, 182, 181, 181, 180, 180, 179, 179, 178, 178,
+	177, 177, 176, 176, 175, 175, 174, 174, 173, 173, 172, 172, 171, 171, 170, 170,
+	169, 169, 168, 168, 167, 167, 166, 166, 165, 165, 164, 164, 163, 163, 162, 162,
+	161, 161, 160, 160, 159, 159, 159, 158, 158, 157, 157, 156, 156, 155, 155, 154,
+	154, 153, 153, 153, 152, 152, 151, 151, 150, 150, 149, 149, 149, 148, 148, 147,
+	147, 146, 146, 146, 145, 145, 144, 144, 143, 143, 143, 142, 142, 141, 141, 140,
+	140, 140, 139, 139, 138, 138, 137, 137, 137, 136, 136, 135, 135, 135, 134, 134,
+	133, 133, 133, 132, 132, 131, 131, 131, 130, 130, 129, 129, 129, 128, 128, 128,
+	127, 127, 126, 126, 126, 125, 125, 124, 124, 124, 123, 123, 123, 122, 122, 121,
+	121, 121, 120, 120, 120, 119, 119, 119, 118, 118, 117, 117, 117, 116, 116, 116,
+	115, 115, 115, 114, 114, 114, 113, 113, 113, 112, 112, 112, 111, 111, 110, 110,
+	110, 109, 109, 109, 108, 108, 108, 107, 107, 107, 106, 106, 106, 105, 105, 105,
+	105, 104, 104, 104, 103, 103, 103, 102, 102, 102, 101, 101, 101, 100, 100, 100,
+	99, 99, 99, 99, 98, 98, 98, 97, 97, 97, 96, 96, 96, 95, 95, 95,
+	95, 94, 94, 94, 93, 93, 93, 93, 92, 92, 92, 91, 91, 91, 90, 90,
+	90, 90, 89, 89, 89, 89, 88, 88, 88, 87, 87, 87, 87, 86, 86, 86,
+	85, 85, 85, 85, 84, 84, 84, 84, 83, 83, 83, 83, 82, 82, 82, 81,
+	81, 81, 81, 80, 80, 80, 80, 79, 79, 79, 79, 78, 78, 78, 78, 77,
+	77, 77, 77, 76, 76, 76, 76, 75, 75, 75, 75, 74, 74, 74, 74, 73,
+	73, 73, 73, 73, 72, 72, 72, 72, 71, 71, 71, 71, 70, 70, 70, 70,
+	70, 69, 69, 69, 69, 68, 68, 68, 68, 67, 67, 67, 67, 67, 66, 66,
+	66, 66, 66, 65, 65, 65, 65, 64, 64, 64, 64, 64, 63, 63, 63, 63,
+	63, 62, 62, 62, 62, 62, 61, 61, 61, 61, 61, 60, 60, 60, 60, 60,
+	59, 59, 59, 59, 59, 58, 58, 58, 58, 58, 57, 57, 57, 57, 57, 56,
+	56, 56, 56, 56, 55, 55, 55, 55, 55, 55, 54, 54, 54, 54, 54, 53,
+	53, 53, 53, 53, 53, 52, 52, 52, 52, 52, 51, 51, 51, 51, 51, 51,
+	50, 50, 50, 50, 50, 50, 49, 49, 49, 49, 49, 49, 48, 48, 48, 48,
+	48, 48, 47, 47, 47, 47, 47, 47, 46, 46, 46, 46, 46, 46, 45, 45,
+	45, 45, 45, 45, 45, 44, 44, 44, 44, 44, 44, 43, 43, 43, 43, 43,
+	43, 43, 42, 42, 42, 42, 42, 42, 42, 41, 41, 41, 41, 41, 41, 41,
+	40, 40, 40, 40, 40, 40, 40, 39, 39, 39, 39, 39, 39, 39, 38, 38,
+	38, 38, 38, 38, 38, 38, 37, 37, 37, 37, 37, 37, 37, 36, 36, 36,
+	36, 36, 36, 36, 36, 35, 35, 35, 35, 35, 35, 35, 35, 34, 34, 34,
+	34, 34, 34, 34, 34, 33, 33, 33, 33, 33, 33, 33, 33, 33, 32, 32,
+	32, 32, 32, 32, 32, 32, 31, 31, 31, 31, 31, 31, 31, 31, 31, 30,
+	30, 30, 30, 30, 30, 30, 30, 30, 29, 29, 29, 29, 29, 29, 29, 29,
+	29, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 27, 27, 27, 27, 27,
+	27, 27, 27, 27, 27, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 25,
+	25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 24, 24, 24, 24, 24, 24,
+	24, 24, 24, 24, 24, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 21, 21, 21, 21,
+	21, 21, 21, 21, 21, 21, 21, 21, 21, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+	19, 19, 19, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+	32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+	48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+	64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+	80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+	96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+	112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+	128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+	144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+	160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+	176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+	192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+	208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+	224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+	240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+	256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271,
+	272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287,
+	288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303,
+	304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319,
+	320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335,
+	336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351,
+	352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367,
+	368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383,
+	384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399,
+	400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415,
+	416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431,
+	432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447,
+	448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463,
+	464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479,
+	480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495,
+	496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511,
+	512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527,
+	528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543,
+	544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559,
+	560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575,
+	576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591,
+	592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+	608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+	624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639,
+	640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655,
+	656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671,
+	672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687,
+	688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703,
+	704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719,
+	720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735,
+	736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751,
+	752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767,
+	768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783,
+	784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795, 796, 797, 798, 799,
+	800, 801, 802, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814, 815,
+	816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831,
+	832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844, 845, 846, 847,
+	848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861, 862, 863,
+	864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876, 877, 878, 879,
+	880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890, 891, 892, 893, 894, 895,
+	896, 897, 898, 899, 900, 901, 902, 903, 904, 905, 906, 907, 908, 909, 910, 911,
+	912, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927,
+	928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942, 943,
+	944, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958, 959,
+	960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 970, 971, 972, 973, 974, 975,
+	976, 977, 978, 979, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990, 991,
+	992, 993, 994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007,
+	1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023,
+	1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039,
+	1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055,
+	1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071,
+	1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+	1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+	1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119,
+	1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135,
+	1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151,
+	1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167,
+	1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183,
+	1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199,
+	1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215,
+	1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231,
+	1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247,
+	1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263,
+	1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279,
+	1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295,
+	1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311,
+	1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327,
+	1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343,
+	1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359,
+	1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375,
+	1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391,
+	1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407,
+	1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423,
+	1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439,
+	1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455,
+	1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471,
+	1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487,
+	1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503,
+	1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519,
+	1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535,
+	1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551,
+	1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567,
+	1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583,
+	1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599,
+	1600, 1601, 1602, 1603, 1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615,
+	1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631,
+	1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647,
+	1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663,
+	1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679,
+	1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695,
+	1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711,
+	1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727,
+	1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743,
+	1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759,
+	1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775,
+	1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791,
+	1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807,
+	1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823,
+	1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837, 1838, 1839,
+	1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855,
+	1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871,
+	1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887,
+	1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903,
+	1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919,
+	1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935,
+	1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951,
+	1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967,
+	1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983,
+	1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999,
+	2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015,
+	2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031,
+	2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047,
+	2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063,
+	2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079,
+	2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095,
+	2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111,
+	2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127,
+	2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143,
+	2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159,
+	2160, 2161, 2162, 2163, 2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174, 2175,
+	2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184, 2185, 2186, 2187, 2188, 2189, 2190, 2191,
+	2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203, 2204, 2205, 2206, 2207,
+	2208, 2209, 2210, 2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220, 2221, 2222, 2223,
+	2224, 2225, 2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239,
+	2240, 2241, 2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255,
+	2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271,
+	2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283, 2284, 2285, 2286, 2287,
+	2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299, 2300, 2301, 2302, 2303,
+	2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319,
+	2320, 2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335,
+	2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345, 2346, 2347, 2348, 2349, 2350, 2351,
+	2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363, 2364, 2365, 2366, 2367,
+	2368, 2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382, 2383,
+	2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395, 2396, 2397, 2398, 2399,
+	2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413, 2414, 2415,
+	2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2424, 2425, 2426, 2427, 2428, 2429, 2430, 2431,
+	2432, 2433, 2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443, 2444, 2445, 2446, 2447,
+	2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458, 2459, 2460, 2461, 2462, 2463,
+	2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473, 2474, 2475, 2476, 2477, 2478, 2479,
+	2480, 2481, 2482, 2483, 2484, 2485, 2486, 2487, 2488, 2489, 2490, 2491, 2492, 2493, 2494, 2495,
+	2496, 2497, 2498, 2499, 2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511,
+	2512, 2513, 2514, 2515, 2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527,
+	2528, 2529, 2530, 2531, 2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543,
+	2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559,
+	2560, 2561, 2562, 2563, 2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575,
+	2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591,
+	2592, 2593, 2594, 2595, 2596, 2597, 2598, 2599, 2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607,
+	2608, 2609, 2610, 2611, 2612, 2613, 2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621, 2622, 2623,
+	2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633, 2634, 2635, 2636, 2637, 2638, 2639,
+	2640, 2641, 2642, 2643, 2644, 2645, 2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653, 2654, 2655,
+	2656, 2657, 2658, 2659, 2660, 2661, 2662, 2663, 2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671,
+	2672, 2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682, 2683, 2684, 2685, 2686, 2687,
+	2688, 2689, 2690, 2691, 2692, 2693, 2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702, 2703,
+	2704, 2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713, 2714, 2715, 2716, 2717, 2718, 2719,
+	2720, 2721, 2722, 2723, 2724, 2725, 2726, 2727, 2728, 2729, 2730, 2731, 2732, 2733, 2734, 2735,
+	2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743, 2744, 2745, 2746, 2747, 2748, 2749, 2750, 2751,
+	2752, 2753, 2754, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762, 2763, 2764, 2765, 2766, 2767,
+	2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776, 2777, 2778, 2779, 2780, 2781, 2782, 2783,
+	2784, 2785, 2786, 2787, 2788, 2789, 2790, 2791, 2792, 2793, 2794, 2795, 2796, 2797, 2798, 2799,
+	2800, 2801, 2802, 2803, 2804, 2805, 2806, 2807, 2808, 2809, 2810, 2811, 2812, 2813, 2814, 2815,
+	2816, 2817, 2818, 2819, 2820, 2821, 2822, 2823, 2824, 2825, 2826, 2827, 2828, 2829, 2830, 2831,
+	2832, 2833, 2834, 2835, 2836, 2837, 2838, 2839, 2840, 2841, 2842, 2843, 2844, 2845, 2846, 2847,
+	2848, 2849, 2850, 2851, 2852, 2853, 2854, 2855, 2856, 2857, 2858, 2859, 2860, 2861, 2862, 2863,
+	2864, 2865, 2866, 2867, 2868, 2869, 2870, 2871, 2872, 2873, 2874, 2875, 2876, 2877, 2878, 2879,
+	2880, 2881, 2882, 2883, 2884, 2885, 2886, 2887, 2888, 2889, 2890, 2891, 2892, 2893, 2894, 2895,
+	2896, 2897, 2898, 2899, 2900, 2901, 2902, 2903, 2904, 2905, 2906, 2907, 2908, 2909, 2910, 2911,
+	2912, 2913, 2914, 2915, 2916, 2917, 2918, 2919, 2920, 2921, 2922, 2923, 2924, 2925, 2926, 2927,
+	2928, 2929, 2930, 2931, 2932, 2933, 2934, 2935, 2936, 2937, 2938, 2939, 2940, 2941, 2942, 2943,
+	2944, 2945, 2946, 2947, 2948, 2949, 2950, 2951, 2952, 2953, 2954, 2955, 2956, 2957, 2958, 2959,
+	2960, 2961, 2962, 2963, 2964, 2965, 2966, 2967, 2968, 2969, 2970, 2971, 2972, 2973, 2974, 2975,
+	2976, 2977, 2978, 2979, 2980, 2981, 2982, 2983, 2984, 2985, 2986, 2987, 2988, 2989, 2990, 2991,
+	2992, 2993, 2994, 2995, 2996, 2997, 2998, 2999, 3000, 3001, 3002, 3003, 3004, 3005, 3006, 3007,
+	3008, 3009, 3010, 3011, 3012, 3013, 3014, 3015, 3016, 3017, 3018, 3019, 3020, 3021, 3022, 3023,
+	3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032, 3033, 3034, 3035, 3036, 3037, 3038, 3039,
+	3040, 3041, 3042, 3043, 3044, 3045, 3046, 3047, 3048, 3049, 3050, 3051, 3052, 3053, 3054, 3055,
+	3056, 3057, 3058, 3059, 3060, 3061, 3062, 3063, 3064, 3065, 3066, 3067, 3068, 3069, 3070, 3071,
+	3072, 3073, 3074, 3075, 3076, 3077, 3078, 3079, 3080, 3081, 3082, 3083, 3084, 3085, 3086, 3087,
+	3088, 3089, 3090, 3091, 3092, 3093, 3094, 3095, 3096, 3097, 3098, 3099, 3100, 3101, 3102, 3103,
+	3104, 3105, 3106, 3107, 3108, 3109, 3110, 3111, 3112, 3113, 3114, 3115, 3116, 3117, 3118, 3119,
+	3120, 3121, 3122, 3123, 3124, 3125, 3126, 3127, 3128, 3129, 3130, 3131, 3132, 3133, 3134, 3135,
+	3136, 3137, 3138, 3139, 3140, 3141, 3142, 3143, 3144, 3145, 3146, 3147, 3148, 3149, 3150, 3151,
+	3152, 3153, 3154, 3155, 3156, 3157, 3158, 3159, 3160, 3161, 3162, 3163, 3164, 3165, 3166, 3167,
+	3168, 3169, 3170, 3171, 3172, 3173, 3174, 3175, 3176, 3177, 3178, 3179, 3180, 3181, 3182, 3183,
+	3184, 3185, 3186, 3187, 3188, 3189, 3190, 3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199,
+	3200, 3201, 3202, 3203, 3204, 3205, 3206, 3207, 3208, 3209, 3210, 3211, 3212, 3213, 3214, 3215,
+	3216, 3217, 3218, 3219, 3220, 3221, 3222, 3223, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 3231,
+	3232, 3233, 3234, 3235, 3236, 3237, 3238, 3239, 3240, 3241, 3242, 3243, 3244, 3245, 3246, 3247,
+	3248, 3249, 3250, 3251, 3252, 3253, 3254, 3255, 3256, 3257, 3258, 3259, 3260, 3261, 3262, 3263,
+	3264, 3265, 3266, 3267, 3268, 3269, 3270, 3271, 3272, 3273, 3274, 3275, 3276, 3277, 3278, 3279,
+	3280, 3281, 3282, 3283, 3284, 3285, 3286, 3287, 3288, 3289, 3290, 3291, 3292, 3293, 3294, 3295,
+	3296, 3297, 3298, 3299, 3300, 3301, 3302, 3303, 3304, 3305, 3306, 3307, 3308, 3309, 3310, 3311,
+	3312, 3313, 3314, 3315, 3316, 3317, 3318, 3319, 3320, 3321, 3322, 3323, 3324, 3325, 3326, 3327,
+	3328, 3329, 3330, 3331, 3332, 3333, 3334, 3335, 3336, 3337, 3338, 3339, 3340, 3341, 3342, 3343,
+	3344, 3345, 3346, 3347, 3348, 3349, 3350, 3351, 3352, 3353, 3354, 3355, 3356, 3357, 3358, 3359,
+	3360, 3361, 3362, 3363, 3364, 3365, 3366, 3367, 3368, 3369, 3370, 3371, 3372, 3373, 3374, 3375,
+	3376, 3377, 3378, 3379, 3380, 3381, 3382, 3383, 3384, 3385, 3386, 3387, 3388, 3389, 3390, 3391,
+	3392, 3393, 3394, 3395, 3396, 3397, 3398, 3399, 3400, 3401, 3402, 3403, 3404, 3405, 3406, 3407,
+	3408, 3409, 3410, 3411, 3412, 3413, 3414, 3415, 3416, 3417, 3418, 3419, 3420, 3421, 3422, 3423,
+	3424, 3425, 3426, 3427, 3428, 3429, 3430, 3431, 3432, 3433, 3434, 3435, 3436, 3437, 3438, 3439,
+	3440, 3441, 3442, 3443, 3444, 3445, 3446, 3447, 3448, 3449, 3450, 3451, 3452, 3453, 3454, 3455,
+	3456, 3457, 3458, 3459, 3460, 3461, 3462, 3463, 3464, 3465, 3466, 3467, 3468, 3469, 3470, 3471,
+	3472, 3473, 3474, 3475, 3476, 3477, 3478, 3479, 3480, 3481, 3482, 3483, 3484, 3485, 3486, 3487,
+	3488, 3489, 3490, 3491, 3492, 3493, 3494, 3495, 3496, 3497, 3498, 3499, 3500, 3501, 3502, 3503,
+	3504, 3505, 3506, 3507, 3508, 3509, 3510, 3511, 3512, 3513, 3514, 3515, 3516, 3517, 3518, 3519,
+	3520, 3521, 3522, 3523, 3524, 3525, 3526, 3527, 3528, 3529, 3530, 3531, 3532, 3533, 3534, 3535,
+	3536, 3537, 3538, 3539, 3540, 3541, 3542, 3543, 3544, 3545, 3546, 3547, 3548, 3549, 3550, 3551,
+	3552, 3553, 3554, 3555, 3556, 3557, 3558, 3559, 3560, 3561, 3562, 3563, 3564, 3565, 3566, 3567,
+	3568, 3569, 3570, 3571, 3572, 3573, 3574, 3575, 3576, 3577, 3578, 3579, 3580, 3581, 3582, 3583,
+	3584, 3585, 3586, 3587, 3588, 3589, 3590, 3591, 3592, 3593, 3594, 3595, 3596, 3597, 3598, 3599,
+	3600, 3601, 3602, 3603, 3604, 3605, 3606, 3607, 3608, 3609, 3610, 3611, 3612, 3613, 3614, 3615,
+	3616, 3617, 3618, 3619, 3620, 3621, 3622, 3623, 3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631,
+	3632, 3633, 3634, 3635, 3636, 3637, 3638, 3639, 3640, 3641, 3642, 3643, 3644, 3645, 3646, 3647,
+	3648, 3649, 3650, 3651, 3652, 3653, 3654, 3655, 3656, 3657, 3658, 3659, 3660, 3661, 3662, 3663,
+	3664, 3665, 3666, 3667, 3668, 3669, 3670, 3671, 3672, 3673, 3674, 3675, 3676, 3677, 3678, 3679,
+	3680, 3681, 3682, 3683, 3684, 3685, 3686, 3687, 3688, 3689, 3690, 3691, 3692, 3693, 3694, 3695,
+	3696, 3697, 3698, 3699, 3700, 3701, 3702, 3703, 3704, 3705, 3706, 3707, 3708, 3709, 3710, 3711,
+	3712, 3713, 3714, 3715, 3716, 3717, 3718, 3719, 3720, 3721, 3722, 3723, 3724, 3725, 3726, 3727,
+	3728, 3729, 3730, 3731, 3732, 3733, 3734, 3735, 3736, 3737, 3738, 3739, 3740, 3741, 3742, 3743,
+	3744, 3745, 3746, 3747, 3748, 3749, 3750, 3751, 3752, 3753, 3754, 3755, 3756, 3757, 3758, 3759,
+	3760, 3761, 3762, 3763, 3764, 3765, 3766, 3767, 3768, 3769, 3770, 3771, 3772, 3773, 3774, 3775,
+	3776, 3777, 3778, 3779, 3780, 3781, 3782, 3783, 3784, 3785, 3786, 3787, 3788, 3789, 3790, 3791,
+	3792, 3793, 3794, 3795, 3796, 3797, 3798, 3799, 3800, 3801, 3802, 3803, 3804, 3805, 3806, 3807,
+	3808, 3809, 3810, 3811, 3812, 3813, 3814, 3815, 3816, 3817, 3818, 3819, 3820, 3821, 3822, 3823,
+	3824, 3825, 3826, 3827, 3828, 3829, 3830, 3831, 3832, 3833, 3834, 3835, 3836, 3837, 3838, 3839,
+	3840, 3841, 3842, 3843, 3844, 3845, 3846, 3847, 3848, 3849, 3850, 3851, 3852, 3853, 3854, 3855,
+	3856, 3857, 3858, 3859, 3860, 3861, 3862, 3863, 3864, 3865, 3866, 3867, 3868, 3869, 3870, 3871,
+	3872, 3873, 3874, 3875, 3876, 3877, 3878, 3879, 3880, 3881, 3882, 3883, 3884, 3885, 3886, 3887,
+	3888, 3889, 3890, 3891, 3892, 3893, 3894, 3895, 3896, 3897, 3898, 3899, 3900, 3901, 3902, 3903,
+	3904, 3905, 3906, 3907, 3908, 3909, 3910, 3911, 3912, 3913, 3914, 3915, 3916, 3917, 3918, 3919,
+	3920, 3921, 3922, 3923, 3924, 3925, 3926, 3927, 3928, 3929, 3930, 3931, 3932, 3933, 3934, 3935,
+	3936, 3937, 3938, 3939, 3940, 3941, 3942, 3943, 3944, 3945, 3946, 3947, 3948, 3949, 3950, 3951,
+	3952, 3953, 3954, 3955, 3956, 3957, 3958, 3959, 3960, 3961, 3962, 3963, 3964, 3965, 3966, 3967,
+	3968, 3969, 3970, 3971, 3972, 3973, 3974, 3975, 3976, 3977, 3978, 3979, 3980, 3981, 3982, 3983,
+	3984, 3985, 3986, 3987, 3988, 3989, 3990, 3991, 3992, 3993, 3994, 3995, 3996, 3997, 3998, 3999,
+	4000, 4001, 4002, 4003, 4004, 4005, 4006, 4007, 4008, 4009, 4010, 4011, 4012, 4013, 4014, 4015,
+	4016, 4017, 4018, 4019, 4020, 4021, 4022, 4023, 4024, 4025, 4026, 4027, 4028, 4029, 4030, 4031,
+	4032, 4033, 4034, 4035, 4036, 4037, 4038, 4039, 4040, 4041, 4042, 4043, 4044, 4045, 4046, 4047,
+	4048, 4049, 4050, 4051, 4052, 4053, 4054, 4055, 4056, 4057, 4058, 4059, 4060, 4061, 4062, 4063,
+	4064, 4065, 4066, 4067, 4068, 4069, 4070, 4071, 4072, 4073, 4074, 4075, 4076, 4077, 4078, 4079,
+	4080, 4081, 4082, 4083, 4084, 4085, 4086, 4087, 4088, 4089, 4090, 4091, 4092, 4093, 4094, 4095,
+	4095, 0,
+};
+
+static const INT32 AMS_TABLE[AMS_ENT*2] = {
+	21, 21, 21, 22, 22, 22, 22, 23, 23, 23, 23, 24, 24, 24, 24, 25,
+	25, 25, 26, 26, 26, 26, 27, 27, 27, 27, 28, 28, 28, 28, 29, 29,
+	29, 29, 29, 30, 30, 30, 30, 31, 31, 31, 31, 32, 32, 32, 32, 32,
+	33, 33, 33, 33, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 36, 36,
+	36, 36, 36, 36, 37, 37, 37, 37, 37, 37, 38, 38, 38, 38, 38, 38,
+	39, 39, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+	41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 42, 42, 42, 42,
+	42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+	42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+	42, 42, 42, 42, 42, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+	41, 40, 40, 40, 40, 40, 40, 40, 40, 40, 39, 39, 39, 39, 39, 39,
+	39, 38, 38, 38, 38, 38, 38, 37, 37, 37, 37, 37, 37, 36, 36, 36,
+	36, 36, 36, 35, 35, 35, 35, 35, 34, 34, 34, 34, 34, 33, 33, 33,
+	33, 32, 32, 32, 32, 32, 31, 31, 31, 31, 30, 30, 30, 30, 29, 29,
+	29, 29, 29, 28, 28, 28, 28, 27, 27, 27, 27, 26, 26, 26, 26, 25,
+	25, 25, 24, 24, 24, 24, 23, 23, 23, 23, 22, 22, 22, 22, 21, 21,
+	21, 21, 20, 20, 20, 20, 19, 19, 19, 18, 18, 18, 18, 17, 17, 17,
+	17, 16, 16, 16, 16, 15, 15, 15, 15, 14, 14, 14, 14, 13, 13, 13,
+	13, 12, 12, 12, 12, 11, 11, 11, 11, 11, 10, 10, 10, 10, 9, 9,
+	9, 9, 9, 8, 8, 8, 8, 8, 7, 7, 7, 7, 7, 6, 6, 6,
+	6, 6, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 3, 3,
+	3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3,
+	3, 3, 3, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 6,
+	6, 6, 6, 6, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 9, 9,
+	9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 11, 11, 12, 12, 12, 12,
+	13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15, 16, 16, 16, 16,
+	17, 17, 17, 17, 18, 18, 18, 18, 19, 19, 19, 20, 20, 20, 20, 21,
+	102, 103, 104, 106, 107, 108, 109, 111, 112, 113, 114, 116, 117, 118, 119, 121,
+	122, 123, 124, 126, 127, 128, 129, 130, 132, 133, 134, 135, 136, 138, 139, 140,
+	141, 142, 143, 145, 146, 147, 148, 149, 150, 151, 152, 153, 155, 156, 157, 158,
+	159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 173,
+	174, 175, 176, 177, 178, 179, 179, 180, 181, 182, 183, 183, 184, 185, 186, 186,
+	187, 188, 188, 189, 190, 190, 191, 192, 192, 193, 193, 194, 194, 195, 196, 196,
+	197, 197, 197, 198, 198, 199, 199, 200, 200, 200, 201, 201, 201, 202, 202, 202,
+	202, 203, 203, 203, 203, 203, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+	204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 203, 203, 203, 203, 203,
+	202, 202, 202, 202, 201, 201, 201, 200, 200, 200, 199, 199, 198, 198, 197, 197,
+	197, 196, 196, 195, 194, 194, 193, 193, 192, 192, 191, 190, 190, 189, 188, 188,
+	187, 186, 186, 185, 184, 183, 183, 182, 181, 180, 179, 179, 178, 177, 176, 175,
+	174, 173, 173, 172, 171, 170, 169, 168, 167, 166, 165, 164, 163, 162, 161, 160,
+	159, 158, 157, 156, 155, 153, 152, 151, 150, 149, 148, 147, 146, 145, 143, 142,
+	141, 140, 139, 138, 136, 135, 134, 133, 132, 130, 129, 128, 127, 126, 124, 123,
+	122, 121, 119, 118, 117, 116, 114, 113, 112, 111, 109, 108, 107, 106, 104, 103,
+	102, 101, 99, 98, 97, 96, 94, 93, 92, 91, 89, 88, 87, 86, 84, 83,
+	82, 81, 79, 78, 77, 76, 75, 73, 72, 71, 70, 69, 67, 66, 65, 64,
+	63, 62, 60, 59, 58, 57, 56, 55, 54, 53, 51, 50, 49, 48, 47, 46,
+	45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30,
+	29, 29, 28, 27, 26, 25, 24, 24, 23, 22, 21, 20, 20, 19, 18, 17,
+	17, 16, 15, 15, 14, 13, 13, 12, 12, 11, 10, 10, 9, 9, 8, 8,
+	7, 7, 6, 6, 5, 5, 5, 4, 4, 4, 3, 3, 3, 2, 2, 2,
+	1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+	1, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5, 5, 5, 6, 6, 7,
+	7, 8, 8, 9, 9, 10, 10, 11, 12, 12, 13, 13, 14, 15, 15, 16,
+	17, 17, 18, 19, 20, 20, 21, 22, 23, 24, 24, 25, 26, 27, 28, 29,
+	29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44,
+	45, 46, 47, 48, 49, 50, 51, 53, 54, 55, 56, 57, 58, 59, 60, 62,
+	63, 64, 65, 66, 67, 69, 70, 71, 72, 73, 75, 76, 77, 78, 79, 81,
+	82, 83, 84, 86, 87, 88, 89, 91, 92, 93, 94, 96, 97, 98, 99, 101,
+};
+
+static const INT32 VIB_TABLE[VIB_ENT*2] = {
+	256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+	256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+	256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+	256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+	256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+	256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+	256, 256, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257,
+	257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257,
+	257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257,
+	257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 256,
+	256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+	256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+	256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+	256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+	256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+	256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+	256, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+	254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+	254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+	254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+	256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+	256, 256, 256, 256, 256, 256, 256, 256, 257, 257, 257, 257, 257, 257, 257, 257,
+	257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257,
+	257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257,
+	257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257,
+	257, 257, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+	258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+	258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+	258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 257,
+	257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257,
+	257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257,
+	257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257,
+	257, 257, 257, 257, 257, 257, 257, 257, 257, 256, 256, 256, 256, 256, 256, 256,
+	256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+	256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+	256, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 254, 254, 254, 254, 254,
+	254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+	254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+	254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+	254, 254, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
+	253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 254,
+	254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+	254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+	254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+	254, 254, 254, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+};
+
@@ -19,7 +19,13 @@
 #define WINDOW_H 480
 #define NUMBER_OF_TUNES 21
 #define TUNE_CHANGE_DELAY_FRAMES 25
-#define TUNE_MAX_PLAYTIME_FRAMES 10450
+#define TUNE_PACK_PATH "tunes.pak" // pisrender --pack tunes.pak tunes
+#define SEEK_STEP_FRAMES 500 // 10 s per left/right keypress
+#ifdef __EMSCRIPTEN__
+#define AUDIO_RENDER_AHEAD_SAMPLES 0 // no threads, render in the callback
+#else
+#define AUDIO_RENDER_AHEAD_SAMPLES 8192 // kept ready by the render worker
+#endif
 
 
 typedef struct {
@@ -27,7 +33,11 @@ typedef struct {
 	int flashing_tune;
 	int playing_tune;	
 	int last_tune_change_frame;
+	long playtime_frames; // of the playing tune, from the replay simulation
 	int last_up_down_keypress_frame;
+	int paused;
+	int pause_requested; // toggled by input, sent by handle_pause_and_seek
+	int seek_request_frames; // relative seek requested by input
 } State;
 
 
@@ -43,6 +53,8 @@ void handle_keydown(SDL_Event *e);
 void handle_keyup(SDL_Event *e);
 void handle_mousebuttondown(SDL_Event *e);
 void handle_tune_change();
+void handle_pause_and_seek();
+long play_tune(int tune);
 void frame_routine();
 void render_tunes_list();
 void render_background();
@@ -65,6 +77,7 @@ SDL_Renderer *renderer;
 TTF_Font *font;
 uint8_t *pixel;
 SDL_Rect tune_rect[NUMBER_OF_TUNES];
+PisPack *tune_pack; // NULL: the tunes are loaded from tune_paths
 
 
 int main (int argc, char **argv) {
@@ -80,8 +93,9 @@ int main (int argc, char **argv) {
 	pixel = calloc(4, WINDOW_W * WINDOW_H);
     SDL_CreateWindowAndRenderer(WINDOW_W, WINDOW_H, 0, &window, &renderer);
 
-	pisplay_init();
-	pisplay_load_and_play(tune_paths[0]);
+	pisplay_init(AUDIO_RENDER_AHEAD_SAMPLES);
+	tune_pack = pisplay_open_pack(TUNE_PACK_PATH);
+	state.playtime_frames = play_tune(0);
 
 #ifdef __EMSCRIPTEN__
 	emscripten_set_main_loop(em_main_loop, 50, 1);
@@ -144,6 +158,7 @@ void shutdown_app () {
 #endif
 	is_terminated = 1;
 	pisplay_shutdown();	
+	pisplay_close_pack(tune_pack);
 	TTF_CloseFont(font);
 	TTF_Quit();
 	SDL_Quit();
@@ -158,6 +173,7 @@ void shutdown_app () {
 void frame_routine() {
 	render_background();
 	render_tunes_list();
+	handle_pause_and_seek();
 	handle_tune_change();
 	SDL_RenderPresent(renderer);
 	state.frame_count++;
@@ -165,6 +181,12 @@ void frame_routine() {
 
 
 void handle_tune_change () {
+	int error = pisplay_audio_error();
+
+	if (error != PIS_OK) {
+		fprintf(stderr, "%s: %s\n", tune_paths[state.playing_tune], pisplay_error_string(error));
+		state.playtime_frames = 0; // on to the next tune
+	}
 	if (state.frame_count - state.last_up_down_keypress_frame >= TUNE_CHANGE_DELAY_FRAMES &&
 		//
 		// Tune change requested by input
@@ -174,8 +196,8 @@ void handle_tune_change () {
 		
 		state.playing_tune = state.flashing_tune;
 		state.last_tune_change_frame = state.frame_count;		
-		pisplay_load_and_play(tune_paths[ state.playing_tune ]);
-	} else if (state.frame_count - state.last_tune_change_frame >= TUNE_MAX_PLAYTIME_FRAMES) {
+		state.playtime_frames = play_tune(state.playing_tune);
+	} else if (state.frame_count - state.last_tune_change_frame >= state.playtime_frames) {
 		//
 		// Handle automatic tune change
 		//
@@ -185,6 +207,28 @@ void handle_tune_change () {
 }
 
 
+//
+// The player is only ever commanded from here and handle_tune_change,
+// the input handlers leave requests in the state
+//
+void handle_pause_and_seek () {
+	if (state.pause_requested != state.paused && pisplay_pause(state.pause_requested) == 0) {
+		state.paused = state.pause_requested;
+	}
+	if (state.paused) {
+		state.last_tune_change_frame++; // the play time stands still
+	}
+	if (state.seek_request_frames) {
+		long position = state.frame_count - state.last_tune_change_frame + state.seek_request_frames;
+		if (position < 0) position = 0;
+		if (position < state.playtime_frames && pisplay_seek(position) == 0) {
+			state.last_tune_change_frame = state.frame_count - position;
+		}
+		state.seek_request_frames = 0;
+	}
+}
+
+
 void render_background () {
 	
 	memset(pixel, 0, WINDOW_W * WINDOW_H << 2);
@@ -391,6 +435,15 @@ void handle_keydown(SDL_Event *e) {
 		if (state.flashing_tune < NUMBER_OF_TUNES - 1) state.flashing_tune++;
 		state.last_up_down_keypress_frame = state.frame_count;
 		break;
+	case SDLK_SPACE:
+		state.pause_requested = !state.pause_requested;
+		break;
+	case SDLK_LEFT:
+		state.seek_request_frames -= SEEK_STEP_FRAMES;
+		break;
+	case SDLK_RIGHT:
+		state.seek_request_frames += SEEK_STEP_FRAMES;
+		break;
 	}
 }
 
@@ -420,6 +473,19 @@ void handle_mousebuttondown(SDL_Event *e) {
 }
 
 
+// From the tune pack when there is one and it has the tune, the file
+// otherwise
+long play_tune(int tune) {
+	const char *name = strrchr(tune_paths[tune], '/') + 1;
+	int index = tune_pack
+			  ? pisplay_pack_find(tune_pack, name)
+			  : PIS_NONE;
+	return (index != PIS_NONE)
+		 ? pisplay_load_and_play_packed(tune_pack, index)
+		 : pisplay_load_and_play(tune_paths[tune]);
+}
+
+
 const char* tune_paths[NUMBER_OF_TUNES] = {
 	"tunes/ACTION.PIS",
 	"tunes/ATPEACE.PIS",
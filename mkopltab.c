@@ -0,0 +1,223 @@
+/*
+**
+** File: mkopltab.c -- generator for the constant tables of fmopl.c
+**
+** Writes fmopl_tables.h to stdout. The table math is the one OPLOpenTable
+** of fmopl.c used to run at startup.
+**
+**   gcc -o mkopltab mkopltab.c -lm
+**   ./mkopltab > fmopl_tables.h           regenerate
+**   ./mkopltab --check fmopl_tables.h     verify the shipped tables
+**
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#ifndef PI
+#define PI 3.14159265358979323846
+#endif
+
+/* these must match the quality selection of fmopl.c,            */
+/* fmopl_tables.h refuses to compile against a different setting */
+#define FREQ_BITS 24
+#define TL_BITS    (FREQ_BITS+2)
+#define SIN_ENT 2048
+#define ENV_BITS 16
+#define EG_ENT   4096
+#define EG_OFF   ((2*EG_ENT)<<ENV_BITS)
+#define EG_DST   (EG_ENT<<ENV_BITS)
+#define EG_STEP (96.0/EG_ENT)
+#define VIB_ENT 512
+#define AMS_ENT 512
+#define VIB_RATE 256
+#define TL_MAX (EG_ENT*2)
+
+static int TL_TABLE[TL_MAX*2];
+static int SIN_TABLE[SIN_ENT*4];	/* offsets into TL_TABLE */
+static int ENV_CURVE[2*EG_ENT+1];
+static int AMS_TABLE[AMS_ENT*2];
+static int VIB_TABLE[VIB_ENT*2];
+
+static void make_tables( void )
+{
+	int s,t;
+	double rate;
+	int i,j;
+	double pom;
+
+	/* make total level table */
+	for (t = 0;t < EG_ENT-1 ;t++){
+		rate = ((1<<TL_BITS)-1)/pow(10,EG_STEP*t/20);	/* dB -> voltage */
+		TL_TABLE[       t] =  (int)rate;
+		TL_TABLE[TL_MAX+t] = -TL_TABLE[t];
+	}
+	/* fill volume off area */
+	for ( t = EG_ENT-1; t < TL_MAX ;t++){
+		TL_TABLE[t] = TL_TABLE[TL_MAX+t] = 0;
+	}
+
+	/* make sinwave table (total level offet) */
+	/* degree 0 = degree 180                   = off */
+	SIN_TABLE[0] = SIN_TABLE[SIN_ENT/2]         = EG_ENT-1;
+	for (s = 1;s <= SIN_ENT/4;s++){
+		pom = sin(2*PI*s/SIN_ENT); /* sin     */
+		pom = 20*log10(1/pom);	   /* decibel */
+		j = pom / EG_STEP;         /* TL_TABLE steps */
+
+        /* degree 0   -  90    , degree 180 -  90 : plus section */
+		SIN_TABLE[          s] = SIN_TABLE[SIN_ENT/2-s] = j;
+        /* degree 180 - 270    , degree 360 - 270 : minus section */
+		SIN_TABLE[SIN_ENT/2+s] = SIN_TABLE[SIN_ENT  -s] = TL_MAX+j;
+	}
+	for (s = 0;s < SIN_ENT;s++)
+	{
+		SIN_TABLE[SIN_ENT*1+s] = s<(SIN_ENT/2) ? SIN_TABLE[s] : EG_ENT;
+		SIN_TABLE[SIN_ENT*2+s] = SIN_TABLE[s % (SIN_ENT/2)];
+		SIN_TABLE[SIN_ENT*3+s] = (s/(SIN_ENT/4))&1 ? EG_ENT : SIN_TABLE[SIN_ENT*2+s];
+	}
+
+	/* envelope counter -> envelope output table */
+	for (i=0; i<EG_ENT; i++)
+	{
+		/* ATTACK curve */
+		pom = pow( ((double)(EG_ENT-1-i)/EG_ENT) , 8 ) * EG_ENT;
+		/* if( pom >= EG_ENT ) pom = EG_ENT-1; */
+		ENV_CURVE[i] = (int)pom;
+		/* DECAY ,RELEASE curve */
+		ENV_CURVE[(EG_DST>>ENV_BITS)+i]= i;
+	}
+	/* off */
+	ENV_CURVE[EG_OFF>>ENV_BITS]= EG_ENT-1;
+	/* make LFO ams table */
+	for (i=0; i<AMS_ENT; i++)
+	{
+		pom = (1.0+sin(2*PI*i/AMS_ENT))/2; /* sin */
+		AMS_TABLE[i]         = (1.0/EG_STEP)*pom; /* 1dB   */
+		AMS_TABLE[AMS_ENT+i] = (4.8/EG_STEP)*pom; /* 4.8dB */
+	}
+	/* make LFO vibrate table */
+	for (i=0; i<VIB_ENT; i++)
+	{
+		/* 100cent = 1seminote = 6% ?? */
+		pom = (double)VIB_RATE*0.06*sin(2*PI*i/VIB_ENT); /* +-100sect step */
+		VIB_TABLE[i]         = VIB_RATE + (pom*0.07); /* +- 7cent */
+		VIB_TABLE[VIB_ENT+i] = VIB_RATE + (pom*0.14); /* +-14cent */
+	}
+}
+
+/* ---------- output into a memory buffer ---------- */
+static char *out;
+static size_t out_len, out_size;
+
+static void put( const char *text )
+{
+	size_t n = strlen(text);
+	if( out_len + n + 1 > out_size )
+	{
+		out_size = (out_len + n + 1) * 2;
+		out = realloc(out, out_size);
+		if( out == NULL ) { perror("mkopltab"); exit(1); }
+	}
+	memcpy(out + out_len, text, n + 1);
+	out_len += n;
+}
+
+/* 'pad' zero entries are appended after the table proper */
+static void put_table( const char *decl, const char *format, const int *table, int n, int pad, int per_line )
+{
+	char item[32];
+	int i;
+
+	put(decl);
+	put(" = {");
+	for (i = 0; i < n+pad; i++)
+	{
+		if( (i % per_line) == 0 ) put("\n\t");
+		sprintf(item, format, i < n ? table[i] : 0);
+		put(item);
+		put(",");
+		if( (i % per_line) != per_line-1 && i != n+pad-1 ) put(" ");
+	}
+	put("\n};\n\n");
+}
+
+static void write_header( void )
+{
+	char line[128];
+
+	put("/* fmopl_tables.h -- constant tables for fmopl.c */\n");
+	put("/* generated by mkopltab.c, do not edit           */\n\n");
+	sprintf(line, "#if (SIN_ENT != %d) || (EG_ENT != %d) || (ENV_BITS != %d) || (TL_BITS != %d)\n",
+		SIN_ENT, EG_ENT, ENV_BITS, TL_BITS);
+	put(line);
+	put("#error \"fmopl_tables.h does not match the quality selection, rerun mkopltab\"\n");
+	put("#endif\n");
+	sprintf(line, "#if (AMS_ENT != %d) || (VIB_ENT != %d) || (VIB_RATE != %d) || (TL_MAX != %d)\n",
+		AMS_ENT, VIB_ENT, VIB_RATE, TL_MAX);
+	put(line);
+	put("#error \"fmopl_tables.h does not match the LFO/layout selection, rerun mkopltab\"\n");
+	put("#endif\n\n");
+
+	/* the 16 bit tables get one spare entry so that a 32 bit gather */
+	/* of their last element stays inside the array                  */
+	put_table("static const INT32 TL_TABLE[TL_MAX*2]", "%d", TL_TABLE, TL_MAX*2, 0, 8);
+	put_table("static const UINT16 SIN_TABLE[SIN_ENT*4+1]", "%d", SIN_TABLE, SIN_ENT*4, 1, 16);
+	put_table("static const UINT16 ENV_CURVE[2*EG_ENT+2]", "%d", ENV_CURVE, 2*EG_ENT+1, 1, 16);
+	put_table("static const INT32 AMS_TABLE[AMS_ENT*2]", "%d", AMS_TABLE, AMS_ENT*2, 0, 16);
+	put_table("static const INT32 VIB_TABLE[VIB_ENT*2]", "%d", VIB_TABLE, VIB_ENT*2, 0, 16);
+}
+
+/* ---------- compare with an existing fmopl_tables.h ---------- */
+static int check( const char *path )
+{
+	FILE *f;
+	char *shipped;
+	long size;
+	size_t i;
+
+	f = fopen(path, "rb");
+	if( f == NULL ) { perror(path); return 1; }
+	fseek(f, 0, SEEK_END);
+	size = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	shipped = malloc(size);
+	if( shipped == NULL || fread(shipped, 1, size, f) != (size_t)size )
+	{
+		fprintf(stderr, "%s: read error\n", path);
+		fclose(f);
+		return 1;
+	}
+	fclose(f);
+
+	if( (size_t)size == out_len && memcmp(shipped, out, out_len) == 0 )
+	{
+		printf("%s: tables match\n", path);
+		free(shipped);
+		return 0;
+	}
+	for (i = 0; i < out_len && i < (size_t)size && shipped[i] == out[i]; i++)
+		;
+	fprintf(stderr, "%s: tables differ from generated output at byte %lu\n",
+		path, (unsigned long)i);
+	free(shipped);
+	return 1;
+}
+
+int main( int argc, char **argv )
+{
+	make_tables();
+	write_header();
+
+	if( argc == 3 && strcmp(argv[1], "--check") == 0 )
+		return check(argv[2]);
+	if( argc != 1 )
+	{
+		fprintf(stderr, "usage: %s [--check fmopl_tables.h]\n", argv[0]);
+		return 2;
+	}
+	fwrite(out, 1, out_len, stdout);
+	return 0;
+}
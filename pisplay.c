@@ -3,12 +3,22 @@
 #include <string.h>
 #include <math.h>
 
+#ifndef PISPLAY_NO_SDL
 #include <SDL2/SDL.h>
+#endif
 
 #ifdef __EMSCRIPTEN__
 #include <emscripten.h>
 #endif
 
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(__EMSCRIPTEN__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define PIS_HAVE_MMAP
+#endif
+
 #include <assert.h>
 
 #include "fmopl.h"
@@ -25,55 +35,1155 @@ const int frequency_table[12] = {
 };
 
 
-PisModule module;
-PisReplayState replay_state;
-int is_playing;
+#ifndef PISPLAY_NO_SDL
 SDL_AudioSpec obtainedAudioSpec;
-FM_OPL *opl;
-INT16 *fmopl_output_buffer;
-float *float_buffer;
-int samples_per_frame;
-int frame_countdown;
+
+//
+// The control side loads a tune into a spare player and hands it over
+// through audio_commands; audio_callback switches to it at a frame
+// boundary and hands the player it retires back through
+// retired_players. Neither side ever waits for the other.
+//
+PisPlayer *sdl_player; // fed to the device, owned by audio_callback
+PisPlayer *spare_player; // control side, the next tune loads into it
+PisPlayer *retiring_player; // audio side, waiting for room in retired_players
+PisQueue audio_commands; // control side to audio_callback
+PisQueue retired_players; // audio_callback to the control side, PIS_COMMAND_STOP
+int audio_paused; // audio side
+float audio_gain = 1; // audio side
+atomic_int audio_error; // set by the audio side, taken by pisplay_audio_error
+
+//
+// With a render worker, the worker is the audio side: it keeps
+// audio_ring filled to render_ahead_bytes in the device format and
+// audio_callback only copies out of it
+//
+SDL_Thread *render_worker; // NULL: audio_callback renders
+SDL_sem *render_worker_wakeup; // posted by audio_callback after a read
+PisRing audio_ring;
+unsigned render_ahead_bytes;
+atomic_int render_worker_quit;
+#endif
 
 
-void pisplay_init() {
-	init_audio();
-	init_opl();
+PisPlayer *pisplay_create(int rate) {
+	PisPlayer *p = calloc(1, sizeof(PisPlayer));
+	if (!p) {
+		return NULL;
+	}
 	
-	fmopl_output_buffer = calloc(2, FMOPL_OUTPUT_BUFFER_SIZE >> 1);
+	p->samples_per_frame = rate / 50;
+	p->opl = OPLCreate(OPL_TYPE_YM3812, OPL_MAGIC, rate);
+	p->fmopl_output_buffer = calloc(2, FMOPL_OUTPUT_BUFFER_SIZE >> 1);
 	
 	// >> 1 to match # of samples
-	float_buffer = calloc(4, FMOPL_OUTPUT_BUFFER_SIZE >> 1); 
+	p->float_buffer = calloc(4, FMOPL_OUTPUT_BUFFER_SIZE >> 1);
+	
+	if (!p->opl || !p->fmopl_output_buffer || !p->float_buffer) {
+		pisplay_destroy(p);
+		return NULL;
+	}
+	oplout(p, 1, 0x20); // enable waveform control
+	return p;
+}
+
+
+void pisplay_destroy(PisPlayer *p) {
+	if (!p) {
+		return;
+	}
+	pisplay_free_seek_index(p);
+	pisplay_free_program(p);
+	free_module(&p->module);
+	pisplay_close_cache(p->cache);
+	free(p->float_buffer);
+	free(p->fmopl_output_buffer);
+	OPLDestroy(p->opl);
+	free(p);
+}
+
+
+// A module that fails to load leaves the player as it was. A fresh
+// .pisc next to the module stands in for parsing and simulating it.
+int pisplay_start(PisPlayer *p, const char *path) {
+	char cache_path[PIS_PATH_MAX];
+	PisModule module;
+	PisCache *cache;
+	uint8_t *data;
+	size_t size;
+	int result = read_file(path, &data, &size);
+
+	if (result != PIS_OK) {
+		return result;
+	}
+	pisplay_cache_path(cache_path, sizeof(cache_path), path);
+	cache = pisplay_open_cache(cache_path);
+	if (cache && pisplay_cache_is_fresh(cache, data, size) && pisplay_start_cache(p, cache) == PIS_OK) {
+		free(data);
+		return PIS_OK;
+	}
+	pisplay_close_cache(cache);
+
+	result = load_module_from_memory(&module, data, size);
+	free(data);
+	if (result == PIS_OK) {
+		start_module(p, &module);
+	}
+	return result;
+}
+
+
+int pisplay_load_from_memory(PisPlayer *p, const void *data, size_t size) {
+	PisModule module;
+	int result = load_module_from_memory(&module, data, size);
+	if (result == PIS_OK) {
+		start_module(p, &module);
+	}
+	return result;
+}
+
+
+// The player takes over the module's arena
+void start_module(PisPlayer *p, PisModule *module) {
+	free_module(&p->module);
+	pisplay_free_seek_index(p);
+	pisplay_close_cache(p->cache);
+	p->cache = NULL;
+	p->module = *module;
+	OPLResetChip(p->opl);
+	memset(p->opl_regs, 0, sizeof(p->opl_regs));
+	pisplay_free_program(p);
+	init_replay_state(p);
+	p->error = PIS_OK;
+	oplout(p, 1, 0x20); // enable waveform control
+	p->is_playing = 1;
+}
+
+
+const char *pisplay_error_string(int error) {
+	switch (error) {
+		case PIS_OK: return "no error";
+		case PIS_ERROR_FILE: return "cannot read the file";
+		case PIS_ERROR_TRUNCATED: return "module is truncated";
+		case PIS_ERROR_RANGE: return "module has a count or index out of range";
+		case PIS_ERROR_MEMORY: return "out of memory";
+		case PIS_ERROR_NOT_REACHED: return "seek target is never reached";
+	}
+	return "unknown error";
+}
+
+
+//
+// Tune pack: mapped once, a tune change is a parse from the mapping
+// with no file access. Where mmap is missing the pack is read whole.
+//
+PisPack *pisplay_open_pack(const char *path) {
+	PisPack *pack = calloc(1, sizeof(PisPack));
+	const PisPackHeader *header;
+
+	if (!pack) {
+		return NULL;
+	}
+	pack->mapped = map_file(path, &pack->data, &pack->size);
+	if (pack->mapped == PIS_NONE) {
+		free(pack);
+		return NULL;
+	}
+
+	//
+	// Header and index must be in the file, every module and .pisc
+	// image inside it
+	//
+	header = (const PisPackHeader *)pack->data;
+	if (pack->size < sizeof(PisPackHeader)
+		|| memcmp(header->magic, PIS_PACK_MAGIC, sizeof(header->magic)) != 0
+		|| header->version != PIS_PACK_VERSION
+		|| header->count > (pack->size - sizeof(PisPackHeader)) / sizeof(PisPackEntry)) {
+		pisplay_close_pack(pack);
+		return NULL;
+	}
+	pack->entry = (const PisPackEntry *)(header + 1);
+	pack->count = header->count;
+	for (int i=0; i<pack->count; i++) {
+		const PisPackEntry *entry = &pack->entry[i];
+		if (entry->offset > pack->size || entry->size > pack->size - entry->offset
+			|| entry->cache_offset > pack->size || entry->cache_size > pack->size - entry->cache_offset) {
+			pisplay_close_pack(pack);
+			return NULL;
+		}
+	}
+	return pack;
+}
+
+
+void pisplay_close_pack(PisPack *pack) {
+	if (!pack) {
+		return;
+	}
+	unmap_file(pack->data, pack->size, pack->mapped);
+	free(pack);
+}
+
+
+int pisplay_pack_find(const PisPack *pack, const char *name) {
+	for (int i=0; i<pack->count; i++) {
+		if (strncmp(pack->entry[i].name, name, PIS_PACK_NAME_SIZE) == 0) {
+			return i;
+		}
+	}
+	return PIS_NONE;
+}
+
+
+// The pack's .pisc image stands in for parsing and simulating the
+// module, as a .pisc file does for pisplay_start. The pack has to
+// outlive the player, which plays from its mapping.
+int pisplay_start_packed(PisPlayer *p, const PisPack *pack, int index) {
+	PisCache *cache;
+
+	if (index < 0 || index >= pack->count) {
+		return PIS_ERROR_RANGE;
+	}
+	cache = pisplay_open_packed_cache(pack, index);
+	if (cache && pisplay_start_cache(p, cache) == PIS_OK) {
+		return PIS_OK;
+	}
+	pisplay_close_cache(cache);
+	return pisplay_load_from_memory(p, pack->data + pack->entry[index].offset, pack->entry[index].size);
+}
+
+
+// 64-bit FNV-1a
+uint64_t pisplay_hash(const void *data, size_t size) {
+	const uint8_t *b = data;
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	while (size--) {
+		hash ^= *b++;
+		hash *= 0x100000001b3ULL;
+	}
+	return hash;
+}
+
+
+//
+// .pisc cache: the decoded module, seek index, play time and levels of
+// one .PIS, written by pisplay_write_cache and used in place from the
+// mapping. A cache of another layout, chip or replay revision is never
+// opened, one of another source is never started.
+//
+void pisplay_cache_path(char *destination, size_t size, const char *path) {
+	const char *name = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+	const char *extension = strrchr(name, '.');
+	int length = extension ? (int)(extension - path) : (int)strlen(path);
+	snprintf(destination, size, "%.*s.pisc", length, path);
+}
+
+
+PisCache *pisplay_open_cache(const char *path) {
+	PisCache *cache = calloc(1, sizeof(PisCache));
+
+	if (!cache) {
+		return NULL;
+	}
+	cache->mapped = map_file(path, &cache->data, &cache->size);
+	if (cache->mapped == PIS_NONE) {
+		free(cache);
+		return NULL;
+	}
+	if (!check_cache(cache)) {
+		pisplay_close_cache(cache);
+		return NULL;
+	}
+	return cache;
+}
+
+
+// The .pisc image a tune pack carries for the entry, NULL without one.
+// It is fresh by construction, both come from the same module.
+PisCache *pisplay_open_packed_cache(const PisPack *pack, int index) {
+	const PisPackEntry *entry = &pack->entry[index];
+	PisCache *cache;
+
+	if (entry->cache_size == 0 || entry->cache_offset % PIS_CACHE_ALIGN != 0) {
+		return NULL;
+	}
+	cache = calloc(1, sizeof(PisCache));
+	if (!cache) {
+		return NULL;
+	}
+	cache->data = pack->data + entry->cache_offset;
+	cache->size = entry->cache_size;
+	cache->borrowed = 1;
+	if (!check_cache(cache)
+		|| cache->header->source_size != entry->size
+		|| cache->header->source_hash != entry->hash) {
+		pisplay_close_cache(cache);
+		return NULL;
+	}
+	return cache;
+}
+
+
+//
+// Every section inside the image and aligned, every index in the
+// module in range: the replay trusts what it is given
+//
+int check_cache(PisCache *cache) {
+	const PisCacheHeader *h = (const PisCacheHeader *)cache->data;
+	PisModule module;
+
+	cache->header = h;
+	if (cache->size < sizeof(PisCacheHeader)
+		|| memcmp(h->magic, PIS_CACHE_MAGIC, sizeof(h->magic)) != 0
+		|| h->version != PIS_CACHE_VERSION
+		|| h->emulator_revision != FMOPL_REVISION
+		|| h->replay_revision != PIS_REPLAY_REVISION
+		|| h->checkpoint_size != sizeof(PisCheckpoint)
+		|| h->number_of_patterns > 128 || h->number_of_instruments > 32
+		|| h->module_size != module_arena_size(h->length, h->number_of_patterns, h->number_of_instruments)
+		|| !cache_section_fits(cache, h->module_offset, h->module_size)
+		|| h->interval_rows < 1 || h->numcheckpoints < 1
+		|| !cache_section_fits(cache, h->checkpoint_offset, (size_t)h->numcheckpoints * sizeof(PisCheckpoint))
+		|| h->first_entry_positions < 0 || h->first_entry_positions > 256
+		|| !cache_section_fits(cache, h->first_entry_offset, h->first_entry_positions * sizeof(int32_t[64]))) {
+		return 0;
+	}
+	layout_module(&module, (void *)(cache->data + h->module_offset),
+		h->length, h->number_of_patterns, h->number_of_instruments);
+	memcpy(module.instrument_slot, h->instrument_slot, sizeof(module.instrument_slot));
+	return check_cached_module(&module) && check_cached_seek_index(cache);
+}
+
+
+void pisplay_close_cache(PisCache *cache) {
+	if (!cache) {
+		return;
+	}
+	if (!cache->borrowed) {
+		unmap_file(cache->data, cache->size, cache->mapped);
+	}
+	free(cache);
+}
+
+
+int pisplay_cache_is_fresh(const PisCache *cache, const void *source, size_t size) {
+	return cache->header->source_size == size
+		&& cache->header->source_hash == pisplay_hash(source, size);
+}
+
+
+//
+// Module and checkpoints stay in the mapping; on success the player owns
+// the cache and closes it with the tune
+//
+int pisplay_start_cache(PisPlayer *p, PisCache *cache) {
+	const PisCacheHeader *h = cache->header;
+	const int32_t *first_entry = (const int32_t *)(cache->data + h->first_entry_offset);
+	PisSeekIndex *index = calloc(1, sizeof(PisSeekIndex));
+	PisModule module;
+
+	if (!index) {
+		return PIS_ERROR_MEMORY;
+	}
+	index->info.length_frames = h->length_frames;
+	index->info.ends = h->ends;
+	index->info.loops = h->loops;
+	index->info.loop_position = h->loop_position;
+	index->info.loop_row = h->loop_row;
+	index->info.loop_start_frame = h->loop_start_frame;
+	index->info.loop_frames = h->loop_frames;
+	index->info.rows = h->rows;
+	index->interval_rows = h->interval_rows;
+	index->checkpoint = (PisCheckpoint *)(cache->data + h->checkpoint_offset);
+	index->numcheckpoints = h->numcheckpoints;
+	index->borrowed = 1;
+	for (int i=0; i<256; i++) {
+		for (int j=0; j<64; j++) {
+			index->first_entry[i][j] = i < h->first_entry_positions ? first_entry[i * 64 + j] : PIS_NONE;
+		}
+	}
+
+	memset(&module, 0, sizeof(module));
+	layout_module(&module, (void *)(cache->data + h->module_offset),
+		h->length, h->number_of_patterns, h->number_of_instruments);
+	memcpy(module.instrument_slot, h->instrument_slot, sizeof(module.instrument_slot));
+	module.borrowed = 1;
+
+	start_module(p, &module);
+	p->seek_index = index;
+	p->cache = cache;
+	return PIS_OK;
+}
+
+
+// Levels measured when the .pisc was written, NULL without one
+const PisLevels *pisplay_levels(const PisPlayer *p) {
+	return p->cache ? &p->cache->header->levels : NULL;
+}
+
+
+//
+// Writes the .pisc of the tune p plays, which was loaded from source.
+// Written under a temporary name and renamed, so a player never maps a
+// partial file.
+//
+int pisplay_write_cache(PisPlayer *p, const char *path, const void *source, size_t size, const PisLevels *levels) {
+	char temp_path[PIS_PATH_MAX];
+	FILE *f;
+	int result;
+
+	snprintf(temp_path, sizeof(temp_path), "%s.tmp", path);
+	f = fopen(temp_path, "wb");
+	if (!f) {
+		return -1;
+	}
+	result = pisplay_write_cache_image(p, f, source, size, levels);
+	if (fclose(f) != 0 || result || rename(temp_path, path) != 0) {
+		remove(temp_path);
+		return -1;
+	}
+	return 0;
+}
+
+
+// The same image at the current position of f, which a tune pack keeps
+// PIS_CACHE_ALIGN aligned; nonzero on error
+int pisplay_write_cache_image(PisPlayer *p, FILE *f, const void *source, size_t size, const PisLevels *levels) {
+	PisCacheHeader h;
+	PisSeekIndex *index;
+	int32_t *first_entry;
+	uint32_t offset;
+	long base = ftell(f);
+	int result;
+
+	if (base < 0
+		|| (!p->seek_index && pisplay_build_seek_index(p, PIS_SEEK_INTERVAL_ROWS) != 0)) {
+		return -1;
+	}
+	index = p->seek_index;
+
+	memset(&h, 0, sizeof(h));
+	memcpy(h.magic, PIS_CACHE_MAGIC, sizeof(h.magic));
+	h.version = PIS_CACHE_VERSION;
+	h.emulator_revision = FMOPL_REVISION;
+	h.replay_revision = PIS_REPLAY_REVISION;
+	h.checkpoint_size = sizeof(PisCheckpoint);
+	h.source_hash = pisplay_hash(source, size);
+	h.source_size = size;
+	h.length_frames = index->info.length_frames;
+	h.ends = index->info.ends;
+	h.loops = index->info.loops;
+	h.loop_position = index->info.loop_position;
+	h.loop_row = index->info.loop_row;
+	h.loop_start_frame = index->info.loop_start_frame;
+	h.loop_frames = index->info.loop_frames;
+	h.rows = index->info.rows;
+	h.levels = *levels;
+	h.length = p->module.length;
+	h.number_of_patterns = p->module.number_of_patterns;
+	h.number_of_instruments = p->module.number_of_instruments;
+	memcpy(h.instrument_slot, p->module.instrument_slot, sizeof(h.instrument_slot));
+	h.interval_rows = index->interval_rows;
+	h.numcheckpoints = index->numcheckpoints;
+
+	// Positions past the last one played are left out
+	for (int i=0; i<256; i++) {
+		for (int j=0; j<64; j++) {
+			if (index->first_entry[i][j] != PIS_NONE) {
+				h.first_entry_positions = i + 1;
+			}
+		}
+	}
+	first_entry = malloc(h.first_entry_positions * sizeof(int32_t[64]) + 1);
+	if (!first_entry) {
+		return -1;
+	}
+	for (int i=0; i<h.first_entry_positions; i++) {
+		for (int j=0; j<64; j++) {
+			first_entry[i * 64 + j] = index->first_entry[i][j];
+		}
+	}
+
+	offset = cache_align(sizeof(h));
+	h.module_offset = offset;
+	h.module_size = p->module.arena_size;
+	offset = cache_align(offset + h.module_size);
+	h.checkpoint_offset = offset;
+	offset = cache_align(offset + h.numcheckpoints * sizeof(PisCheckpoint));
+	h.first_entry_offset = offset;
+
+	result = write_cache_section(f, base, 0, &h, sizeof(h))
+		  || write_cache_section(f, base, h.module_offset, p->module.arena, h.module_size)
+		  || write_cache_section(f, base, h.checkpoint_offset, index->checkpoint, h.numcheckpoints * sizeof(PisCheckpoint))
+		  || write_cache_section(f, base, h.first_entry_offset, first_entry, h.first_entry_positions * sizeof(int32_t[64]));
+	free(first_entry);
+	return result;
+}
+
+
+int pisplay_render(PisPlayer *p, INT16 *buffer, int numsamples) {
+	// Run the replay for every frame starting inside the buffer; its
+	// writes are queued and land on the frame's exact sample. Returns
+	// p->error, set once a write was dropped for want of queue memory
+	UINT32 end = OPLGetTime(p->opl) + numsamples;
+	while ((INT32)(p->frame_time - end) < 0) {
+		replay_frame_routine(p);
+		p->frame_time += p->samples_per_frame;
+		p->frame++;
+	}
+	
+	YM3812UpdateQueued(p->opl, buffer, numsamples);
+	return p->error;
+}
+
+
+//
+// Synthesis-free replay: only the row state machine runs, OPL writes are
+// dropped in oplout. A tune either stops on F00 or, since the flow of
+// rows depends on nothing but the state packed by replay_flow_key, loops
+// from the first row entry whose key repeats.
+//
+uint64_t replay_flow_key(PisReplayState *s) {
+	uint64_t key = s->position & 0xff;
+	key = (key << 6) | (s->row & 63);
+	key = (key << 8) | (s->speed & 0xff);
+	key = (key << 1) | (s->loop_flag != 0);
+	key = (key << 6) | (s->loop_start_row & 63);
+	key = (key << 5) | ((s->loop_count + 1) & 31);
+	return key;
+}
+
+
+int pisplay_simulate(PisPlayer *p, PisSongInfo *info, long max_frames) {
+	PisReplayState saved_state = p->replay_state;
+	int saved_is_playing = p->is_playing;
+	UINT32 saved_frame_time = p->frame_time;
+	long saved_frame = p->frame;
+	uint8_t saved_regs[256];
+	uint64_t *keys;
+	long *entry_frame;
+	long frame = 0;
+	int size = 1024, used = 0, result = 0;
+
+	// The seek index, built or from a .pisc, holds the full simulation
+	if (p->seek_index && max_frames == PIS_SIMULATE_MAX_FRAMES) {
+		*info = p->seek_index->info;
+		return 0;
+	}
+
+	memset(info, 0, sizeof(PisSongInfo));
+	keys = malloc(size * sizeof(uint64_t));
+	entry_frame = malloc(size * sizeof(long));
+	if (!keys || !entry_frame) {
+		free(keys);
+		free(entry_frame);
+		return -1;
+	}
+	memset(keys, 0xff, size * sizeof(uint64_t)); // all ones: empty slot
+
+	memcpy(saved_regs, p->opl_regs, sizeof(saved_regs));
+	init_replay_state(p);
+	p->is_playing = 1;
+	p->simulate = 1;
+
+	while (p->is_playing && frame < max_frames) {
+		PisReplayState *s = &p->replay_state;
+		
+		//
+		// Frames between rows only run per-frame effects, which never
+		// change the row flow: skip straight to the next row entry
+		//
+		if (s->count + 1 < s->speed) {
+			frame += s->speed - 1 - s->count;
+			s->count = s->speed - 1;
+			if (frame >= max_frames) break;
+		}
+
+		uint64_t key = replay_flow_key(s);
+		int slot = (int)((key * 0x9e3779b97f4a7c15ULL) >> 40) & (size - 1);
+		while (keys[slot] != ~0ULL && keys[slot] != key) {
+			slot = (slot + 1) & (size - 1);
+		}
+		if (keys[slot] == key) {
+			info->loops = 1;
+			info->loop_position = s->position;
+			info->loop_row = s->row;
+			info->loop_start_frame = entry_frame[slot];
+			info->loop_frames = frame - entry_frame[slot];
+			break;
+		}
+		keys[slot] = key;
+		entry_frame[slot] = frame;
+		
+		if (++used * 2 > size) {
+			//
+			// Grow the table
+			//
+			int i, old_size = size;
+			uint64_t *old_keys = keys;
+			long *old_entry_frame = entry_frame;
+			size *= 2;
+			keys = malloc(size * sizeof(uint64_t));
+			entry_frame = malloc(size * sizeof(long));
+			if (!keys || !entry_frame) {
+				free(old_keys);
+				free(old_entry_frame);
+				result = -1;
+				break;
+			}
+			memset(keys, 0xff, size * sizeof(uint64_t));
+			for (i=0; i<old_size; i++) {
+				if (old_keys[i] != ~0ULL) {
+					slot = (int)((old_keys[i] * 0x9e3779b97f4a7c15ULL) >> 40) & (size - 1);
+					while (keys[slot] != ~0ULL) {
+						slot = (slot + 1) & (size - 1);
+					}
+					keys[slot] = old_keys[i];
+					entry_frame[slot] = old_entry_frame[i];
+				}
+			}
+			free(old_keys);
+			free(old_entry_frame);
+		}
+
+		replay_frame_routine(p);
+		info->rows++;
+		frame++;
+	}
+
+	info->length_frames = frame < max_frames ? frame : max_frames;
+	info->ends = !p->is_playing;
+
+	free(keys);
+	free(entry_frame);
+	p->simulate = 0;
+	p->replay_state = saved_state;
+	p->is_playing = saved_is_playing;
+	p->frame_time = saved_frame_time;
+	p->frame = saved_frame;
+	memcpy(p->opl_regs, saved_regs, sizeof(saved_regs));
+	return result;
+}
+
+
+//
+// Seek index: the replay state and OPL register file at the first frame
+// of every interval_rows-th row. Per-frame effects change voice state, so
+// unlike pisplay_simulate every frame is run.
+//
+int pisplay_build_seek_index(PisPlayer *p, int interval_rows) {
+	PisReplayState saved_state = p->replay_state;
+	int saved_is_playing = p->is_playing;
+	UINT32 saved_frame_time = p->frame_time;
+	long saved_frame = p->frame;
+	uint8_t saved_regs[256];
+	PisSeekIndex *index;
+	int size = 64, result = 0;
+	long rows = 0, frame;
+
+	if (interval_rows < 1) {
+		return -1;
+	}
+	index = calloc(1, sizeof(PisSeekIndex));
+	if (!index) {
+		return -1;
+	}
+	if (pisplay_simulate(p, &index->info, PIS_SIMULATE_MAX_FRAMES) != 0) {
+		free(index);
+		return -1;
+	}
+	index->interval_rows = interval_rows;
+	index->checkpoint = malloc(size * sizeof(PisCheckpoint));
+	if (!index->checkpoint) {
+		free(index);
+		return -1;
+	}
+	for (int i=0; i<256; i++) {
+		for (int j=0; j<64; j++) {
+			index->first_entry[i][j] = PIS_NONE;
+		}
+	}
+
+	//
+	// Start from the register file pisplay_start leaves behind
+	//
+	memcpy(saved_regs, p->opl_regs, sizeof(saved_regs));
+	memset(p->opl_regs, 0, sizeof(p->opl_regs));
+	p->opl_regs[1] = 0x20;
+	init_replay_state(p);
+	p->is_playing = 1;
+	p->simulate = 1;
+
+	for (frame = 0; frame < index->info.length_frames && p->is_playing; frame++) {
+		PisReplayState *s = &p->replay_state;
+
+		if (s->count + 1 >= s->speed) {
+			long *first = &index->first_entry[s->position & 0xff][s->row & 63];
+			if (*first == PIS_NONE) {
+				*first = frame;
+			}
+			if (rows++ % interval_rows == 0) {
+				PisCheckpoint *c;
+				if (index->numcheckpoints == size) {
+					c = realloc(index->checkpoint, 2 * size * sizeof(PisCheckpoint));
+					if (!c) {
+						result = -1;
+						break;
+					}
+					index->checkpoint = c;
+					size *= 2;
+				}
+				c = &index->checkpoint[ index->numcheckpoints++ ];
+				c->frame = frame;
+				c->replay_state = *s;
+				c->is_playing = p->is_playing;
+				memcpy(c->opl_regs, p->opl_regs, sizeof(c->opl_regs));
+			}
+		}
+		replay_frame_routine(p);
+	}
+
+	p->simulate = 0;
+	p->replay_state = saved_state;
+	p->is_playing = saved_is_playing;
+	p->frame_time = saved_frame_time;
+	p->frame = saved_frame;
+	memcpy(p->opl_regs, saved_regs, sizeof(saved_regs));
+
+	if (result != 0 || index->numcheckpoints == 0) {
+		free(index->checkpoint);
+		free(index);
+		return -1;
+	}
+	pisplay_free_seek_index(p);
+	p->seek_index = index;
+	return 0;
+}
+
+
+//
+// Continue playback from any frame: restore the nearest checkpoint at or
+// before it, replay the rest without synthesis and load the resulting
+// register file into a freshly reset chip. Envelopes start over from the
+// key-on, everything else is exactly what linear playback would have.
+// The SDL player is seeked through pisplay_seek, from audio_callback.
+//
+void pisplay_free_seek_index(PisPlayer *p) {
+	if (p->seek_index) {
+		if (!p->seek_index->borrowed) {
+			free(p->seek_index->checkpoint);
+		}
+		free(p->seek_index);
+		p->seek_index = NULL;
+	}
+}
+
+
+int pisplay_seek_frame(PisPlayer *p, long frame) {
+	PisSeekIndex *index;
+	PisCheckpoint *c;
+	long target = frame;
+	int lo, hi;
+
+	if (frame < 0) {
+		return PIS_ERROR_NOT_REACHED;
+	}
+	if (!p->seek_index && pisplay_build_seek_index(p, PIS_SEEK_INTERVAL_ROWS) != 0) {
+		return PIS_ERROR_MEMORY;
+	}
+	index = p->seek_index;
+
+	//
+	// The index covers one pass; later frames of a looping tune fold back
+	// into the loop, a stopped tune stays stopped
+	//
+	if (target >= index->info.length_frames) {
+		if (index->info.loops && index->info.loop_frames > 0) {
+			target = index->info.loop_start_frame
+				   + (target - index->info.loop_start_frame) % index->info.loop_frames;
+		} else {
+			target = index->info.length_frames;
+		}
+	}
+
+	lo = 0;
+	hi = index->numcheckpoints - 1;
+	while (lo < hi) {
+		int mid = (lo + hi + 1) / 2;
+		if (index->checkpoint[mid].frame <= target) {
+			lo = mid;
+		} else {
+			hi = mid - 1;
+		}
+	}
+	c = &index->checkpoint[lo];
+
+	p->replay_state = c->replay_state;
+	p->is_playing = c->is_playing;
+	memcpy(p->opl_regs, c->opl_regs, sizeof(p->opl_regs));
+	p->simulate = 1;
+	for (long f = c->frame; f < target; f++) {
+		replay_frame_routine(p);
+	}
+	p->simulate = 0;
+
+	opl_load_registers(p);
+	p->frame = frame;
+	return PIS_OK;
+}
+
+
+int pisplay_seek_time(PisPlayer *p, double seconds) {
+	return pisplay_seek_frame(p, (long)(seconds * 50));
+}
+
+
+// Seeks to where the row is first played, fails if it never is
+int pisplay_seek_position(PisPlayer *p, int position, int row) {
+	if (position < 0 || position > 255 || row < 0 || row > 63) {
+		return PIS_ERROR_NOT_REACHED;
+	}
+	if (!p->seek_index && pisplay_build_seek_index(p, PIS_SEEK_INTERVAL_ROWS) != 0) {
+		return PIS_ERROR_MEMORY;
+	}
+	if (p->seek_index->first_entry[position][row] == PIS_NONE) {
+		return PIS_ERROR_NOT_REACHED;
+	}
+	return pisplay_seek_frame(p, p->seek_index->first_entry[position][row]);
+}
+
+
+//
+// Exact snapshot of a playing tune. Loading one into a player with the
+// same tune and rate resumes sample for sample where the save was made.
+//
+void pisplay_save_state(PisPlayer *p, PisPlayerState *state) {
+	// Writes still queued for now (after pisplay_start or a seek) are not
+	// part of the chip state, apply them first
+	YM3812UpdateQueued(p->opl, NULL, 0);
+	state->replay_state = p->replay_state;
+	state->is_playing = p->is_playing;
+	state->frame_time = p->frame_time;
+	state->frame = p->frame;
+	memcpy(state->opl_regs, p->opl_regs, sizeof(state->opl_regs));
+	OPLSaveState(p->opl, &state->opl);
+}
+
+
+int pisplay_load_state(PisPlayer *p, const PisPlayerState *state) {
+	if (OPLLoadState(p->opl, &state->opl) != 0) {
+		return -1;
+	}
+	p->replay_state = state->replay_state;
+	p->is_playing = state->is_playing;
+	p->frame_time = state->frame_time;
+	p->frame = state->frame;
+	memcpy(p->opl_regs, state->opl_regs, sizeof(p->opl_regs));
+	return 0;
+}
+
+
+//
+// Row compiler: every decision replay_voice takes on the row alone, the
+// kind of row, Cxx and the effect dispatch, is taken here once. What is
+// left per voice and row is a short run of ops whose only branches test
+// the voice state. Rows are compiled per pattern, the order list just
+// picks the run each voice executes.
+//
+int pisplay_compile(PisPlayer *p) {
+	PisProgram *program = calloc(1, sizeof(PisProgram));
+	PisOp row_ops[PIS_ROW_MAX_OPS];
+	int numpatterns = p->module.number_of_patterns + 1;
+	int size = 0;
+
+	if (!program || !(program->start = malloc(numpatterns * sizeof(*program->start)))) {
+		free(program);
+		return -1;
+	}
+	for (int i=0; i<numpatterns; i++) {
+		for (int row=0; row<64; row++) {
+			int n = compile_row(row_ops, &p->module.pattern[i][row]);
+			if (program->numops + n > size) {
+				PisOp *grown;
+				size = size ? size * 2 : 4096;
+				grown = realloc(program->op, size * sizeof(PisOp));
+				if (!grown) {
+					free(program->op);
+					free(program->start);
+					free(program);
+					return -1;
+				}
+				program->op = grown;
+			}
+			program->start[i][row] = program->numops;
+			memcpy(&program->op[ program->numops ], row_ops, n * sizeof(PisOp));
+			program->numops += n;
+		}
+	}
+
+	pisplay_free_program(p);
+	p->program = program;
+	return 0;
+}
+
+
+void pisplay_free_program(PisPlayer *p) {
+	if (p->program) {
+		free(p->program->start);
+		free(p->program->op);
+		free(p->program);
+		p->program = NULL;
+	}
+}
+
+
+// Returns -1 when the queue is full
+int pisplay_queue_push(PisQueue *q, const PisCommand *command) {
+	unsigned tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+	if (tail - atomic_load_explicit(&q->head, memory_order_acquire) == PIS_QUEUE_SIZE) {
+		return -1;
+	}
+	q->command[ tail & (PIS_QUEUE_SIZE - 1) ] = *command;
+	atomic_store_explicit(&q->tail, tail + 1, memory_order_release);
+	return 0;
+}
+
+
+// Returns -1 when the queue is empty
+int pisplay_queue_pop(PisQueue *q, PisCommand *command) {
+	unsigned head = atomic_load_explicit(&q->head, memory_order_relaxed);
+	if (head == atomic_load_explicit(&q->tail, memory_order_acquire)) {
+		return -1;
+	}
+	*command = q->command[ head & (PIS_QUEUE_SIZE - 1) ];
+	atomic_store_explicit(&q->head, head + 1, memory_order_release);
+	return 0;
+}
+
+
+//
+// Ring of bytes: fill is write - read, unsigned wrap-around included.
+// Returns the bytes actually moved.
+//
+int pisplay_ring_init(PisRing *ring, unsigned min_size) {
+	unsigned size = 1;
+	while (size < min_size) {
+		size <<= 1;
+	}
+	ring->data = calloc(1, size);
+	ring->size = size;
+	atomic_init(&ring->read, 0);
+	atomic_init(&ring->write, 0);
+	return ring->data ? 0 : -1;
+}
+
+
+void pisplay_ring_free(PisRing *ring) {
+	free(ring->data);
+	ring->data = NULL;
+}
+
+
+unsigned pisplay_ring_fill(PisRing *ring) {
+	return atomic_load_explicit(&ring->write, memory_order_acquire)
+		 - atomic_load_explicit(&ring->read, memory_order_acquire);
+}
+
+
+unsigned pisplay_ring_write(PisRing *ring, const void *data, unsigned size) {
+	unsigned write = atomic_load_explicit(&ring->write, memory_order_relaxed);
+	unsigned space = ring->size - (write - atomic_load_explicit(&ring->read, memory_order_acquire));
+	unsigned offset = write & (ring->size - 1);
+	unsigned first;
+
+	if (size > space) {
+		size = space;
+	}
+	first = size < ring->size - offset ? size : ring->size - offset;
+	memcpy(ring->data + offset, data, first);
+	memcpy(ring->data, (const uint8_t *)data + first, size - first);
+	atomic_store_explicit(&ring->write, write + size, memory_order_release);
+	return size;
+}
+
+
+unsigned pisplay_ring_read(PisRing *ring, void *data, unsigned size) {
+	unsigned read = atomic_load_explicit(&ring->read, memory_order_relaxed);
+	unsigned fill = atomic_load_explicit(&ring->write, memory_order_acquire) - read;
+	unsigned offset = read & (ring->size - 1);
+	unsigned first;
+
+	if (size > fill) {
+		size = fill;
+	}
+	first = size < ring->size - offset ? size : ring->size - offset;
+	memcpy(data, ring->data + offset, first);
+	memcpy((uint8_t *)data + first, ring->data, size - first);
+	atomic_store_explicit(&ring->read, read + size, memory_order_release);
+	return size;
+}
+
+
+#ifndef PISPLAY_NO_SDL
+// render_ahead_samples > 0 renders on a worker thread that keeps that
+// many samples ready, 0 or a failed thread start renders in the callback.
+// The players are created last, at the rate of the device finally open
+void pisplay_init(int render_ahead_samples) {
+	init_audio(render_ahead_samples > 0 ? PIS_WORKER_DEVICE_SAMPLES : PIS_DEVICE_SAMPLES);
+	if (render_ahead_samples > 0 && start_render_worker(render_ahead_samples) != 0) {
+		SDL_CloseAudio();
+		init_audio(PIS_DEVICE_SAMPLES);
+	}
+	init_opl();
+	SDL_PauseAudio(0); // silence until the first tune arrives
 }
 
 
 void pisplay_shutdown() {
-	is_playing = 0;
+	PisCommand command;
+
+	// The worker goes first, the callback may still post its semaphore
+	if (render_worker) {
+		atomic_store(&render_worker_quit, 1);
+		SDL_SemPost(render_worker_wakeup);
+		SDL_WaitThread(render_worker, NULL);
+	}
 	SDL_PauseAudio(1);
-	free(float_buffer);
-	free(fmopl_output_buffer);
-	OPLDestroy(opl);
 	SDL_CloseAudio();
+	if (render_worker) {
+		SDL_DestroySemaphore(render_worker_wakeup);
+		pisplay_ring_free(&audio_ring);
+		render_worker = NULL;
+	}
+	pisplay_destroy(sdl_player);
+	pisplay_destroy(spare_player);
+	pisplay_destroy(retiring_player);
+	sdl_player = spare_player = retiring_player = NULL;
+	while (pisplay_queue_pop(&audio_commands, &command) == 0) {
+		pisplay_destroy(command.player);
+	}
+	while (pisplay_queue_pop(&retired_players, &command) == 0) {
+		pisplay_destroy(command.player);
+	}
 }
 
 
-void pisplay_load_and_play(const char *path) {
+// Returns the play time in frames: up to the loop point's first repeat,
+// or to the F00 stop plus a tail for the last notes to ring out
+long pisplay_load_and_play(const char *path) {
+	PisPlayer *p = take_spare_player();
+	PisSongInfo info;
 	
-	if (is_playing) {
-		is_playing = 0;
-		SDL_PauseAudio(1);
+	if (!p || pisplay_start(p, path) != PIS_OK) {
+		spare_player = p;
+		return 0; // nothing to play, on to the next tune
 	}
-	
-	load_module(path, &module);
-	OPLResetChip(opl);
-	oplout(1, 0x20); // enable waveform control
-	init_replay_state(&replay_state);
-	is_playing = 1;
-	SDL_PauseAudio(0);	
+
+	//
+	// The seek index comes with a .pisc or is built here, never in the
+	// callback, and holds the simulation. Without one the callback
+	// ignores seeks and the play time is simulated on its own.
+	//
+	if (p->seek_index || pisplay_build_seek_index(p, PIS_SEEK_INTERVAL_ROWS) == 0) {
+		info = p->seek_index->info;
+	} else if (pisplay_simulate(p, &info, PIS_SIMULATE_MAX_FRAMES) != 0) {
+		return play_player(p, PIS_SIMULATE_MAX_FRAMES);
+	}
+	return play_player(p, info.ends
+						? info.length_frames + PIS_END_TAIL_FRAMES
+						: info.length_frames);
+}
+
+
+// From a tune pack, the play time comes from its index and the module
+// and seek index from the tune's .pisc image in the pack: no parsing
+// and no replay simulation. A pack without images parses the module and
+// builds the seek index here.
+long pisplay_load_and_play_packed(const PisPack *pack, int index) {
+	PisPlayer *p = take_spare_player();
+
+	if (!p || pisplay_start_packed(p, pack, index) != PIS_OK) {
+		spare_player = p;
+		return 0; // nothing to play, on to the next tune
+	}
+	// If the seek index fails to build, out of memory, the callback
+	// ignores seeks
+	if (!p->seek_index) {
+		pisplay_build_seek_index(p, PIS_SEEK_INTERVAL_ROWS);
+	}
+	return play_player(p, pack->entry[index].duration_frames);
+}
+
+
+// Stops after the current frame, the chip is not heard again
+int pisplay_stop() {
+	return send_audio_command(PIS_COMMAND_STOP, NULL, 0, 0);
+}
+
+
+int pisplay_pause(int paused) {
+	return send_audio_command(PIS_COMMAND_PAUSE, NULL, 0, paused);
+}
+
+
+int pisplay_seek(long frame) {
+	return send_audio_command(PIS_COMMAND_SEEK, NULL, frame, 0);
 }
 
 
-void init_replay_state(PisReplayState *pstate) {
+int pisplay_set_gain(float gain) {
+	return send_audio_command(PIS_COMMAND_GAIN, NULL, 0, gain);
+}
+
+
+// Why the audio side stopped the playing tune, PIS_OK if it has not.
+// Reported once.
+int pisplay_audio_error() {
+	return atomic_exchange(&audio_error, PIS_OK);
+}
+
+
+long play_player(PisPlayer *p, long duration_frames) {
+	if (send_audio_command(PIS_COMMAND_PLAY, p, 0, 0) != 0) {
+		spare_player = p;
+		return 0;
+	}
+	return duration_frames;
+}
+
+
+// A player the audio side is done with, else a new one. Players retired
+// beyond the one kept as the spare are destroyed here.
+PisPlayer *take_spare_player() {
+	PisCommand command;
+	PisPlayer *p = spare_player;
+
+	spare_player = NULL;
+	while (pisplay_queue_pop(&retired_players, &command) == 0) {
+		if (p) {
+			pisplay_destroy(command.player);
+		} else {
+			p = command.player;
+		}
+	}
+	return p ? p : pisplay_create(obtainedAudioSpec.freq);
+}
+
+
+// Returns -1 when audio_callback has fallen PIS_QUEUE_SIZE commands behind
+int send_audio_command(int type, PisPlayer *player, long frame, float value) {
+	PisCommand command;
+	command.type = type;
+	command.player = player;
+	command.frame = frame;
+	command.value = value;
+	return pisplay_queue_push(&audio_commands, &command);
+}
+#endif
+
+
+void init_replay_state(PisPlayer *p) {
+	PisReplayState *pstate = &p->replay_state;
 	memset(pstate, 0, sizeof(PisReplayState));
 	pstate->speed = PIS_DEFAULT_SPEED;
 	pstate->count = PIS_DEFAULT_SPEED - 1;
@@ -83,82 +1193,314 @@ void init_replay_state(PisReplayState *pstate) {
 		pstate->voice_state[i].instrument = PIS_NONE;
 	}
 
-	frame_countdown = samples_per_frame;
+	p->frame_time = OPLGetTime(p->opl);
+	p->frame = 0;
 }
 
 
-void replay_frame_routine() {
-	if (is_playing) {			
-		replay_state.count++;
-		if (replay_state.count >= replay_state.speed) {
+void replay_frame_routine(PisPlayer *p) {
+	if (p->is_playing) {			
+		p->replay_state.count++;
+		if (p->replay_state.count >= p->replay_state.speed) {
 
-			unpack_row();
+			unpack_row(p);
 			
-			for (int v=0; v<9; v++) {
-				replay_voice(v);
-			}			
+			if (p->program) {
+				// E6x moves the row while the voices run, take it first
+				uint8_t *order = PIS_ORDER(&p->module, p->replay_state.position);
+				int row = p->replay_state.row;
+				for (int v=0; v<9; v++) {
+					replay_voice_compiled(p, v, order[v], row);
+				}
+			} else {
+				for (int v=0; v<9; v++) {
+					replay_voice(p, v);
+				}
+			}
 			
-			advance_row();
+			advance_row(p);
 		} else {
-			replay_do_per_frame_effects();
+			replay_do_per_frame_effects(p);
 		}
 	}
 }
 
 
-void replay_voice(int v) {
-	PisVoiceState *vs = &replay_state.voice_state[v];	
-	PisRowUnpacked r = replay_state.row_buffer[v];
+void replay_voice(PisPlayer *p, int v) {
+	PisVoiceState *vs = &p->replay_state.voice_state[v];	
+	PisRowUnpacked r = p->replay_state.row_buffer[v];
 
 	if (EFFECT_HI(&r) == 0x03) {
 		//
 		// With portamento
 		//
-		replay_enter_row_with_portamento(v, vs, &r);
+		replay_enter_row_with_portamento(p, v, vs, &r);
 	} else {
 		if (HAS_INSTRUMENT(&r)) {
 			if (HAS_NOTE(&r)) {
 				//
 				// Instrument + note
 				//
-				replay_enter_row_with_instrument_and_note(v, vs, &r);
+				replay_enter_row_with_instrument_and_note(p, v, vs, &r);
 			} else {
 				//
 				// Instrument only
 				//
-				replay_enter_row_with_instrument_only(v, vs, &r);
+				replay_enter_row_with_instrument_only(p, v, vs, &r);
 			}			
 		} else {
 			if (HAS_NOTE(&r)) {
 				//
 				// Note only
 				//
-				replay_enter_row_with_note_only(v, vs, &r);				
+				replay_enter_row_with_note_only(p, v, vs, &r);				
 			} else {
 				//
 				// Possibly effect only
 				//
-				replay_enter_row_with_possibly_effect_only(v, vs, &r);
+				replay_enter_row_with_possibly_effect_only(p, v, vs, &r);
 			}			
 		}
 	}
 	
-	replay_handle_effect(v, vs, &r);
+	replay_handle_effect(p, v, vs, &r);
 	
 	if (r.effect) {
 		vs->previous_effect = r.effect;
 	} else {
 		vs->previous_effect = PIS_NONE;
-		replay_reset_voice(v);
+		replay_reset_voice(p, v);
 	}	
 }
 
 
-void replay_enter_row_with_portamento(int v, PisVoiceState *vs, PisRowUnpacked *r) {
+// The ops of one voice and row, terminated by PIS_OP_END, in the order
+// replay_voice would do the same work
+int compile_row(PisOp *op, const PisRowUnpacked *r) {
+	PisOp *o = op;
+	int gain = (EFFECT_HI(r) == 0x0c)
+			 ? EFFECT_LO(r)
+			 : PIS_NONE;
+
+	if (EFFECT_HI(r) == 0x03) {
+		if (HAS_INSTRUMENT(r)) {
+			o = emit_op(o, PIS_OP_PORTA_INSTRUMENT, r->instrument, 0);
+		}
+		if (HAS_NOTE(r)) {
+			o = emit_op(o, PIS_OP_PORTA_TARGET, r->note, r->octave);
+		}
+	} else if (HAS_INSTRUMENT(r) && HAS_NOTE(r)) {
+		o = emit_op(o, PIS_OP_NOTE_OFF, 0, 0);
+		if (gain == PIS_NONE) {
+			o = emit_op(o, PIS_OP_INSTRUMENT, r->instrument, 0);
+		} else {
+			o = emit_op(o, PIS_OP_NEW_INSTRUMENT, r->instrument, 0);
+			o = emit_op(o, PIS_OP_LEVEL, r->instrument, gain);
+		}
+		o = emit_op(o, PIS_OP_NOTE, r->note, r->octave);
+	} else if (HAS_INSTRUMENT(r)) {
+		o = emit_op(o, PIS_OP_SWITCH_INSTRUMENT, r->instrument, gain);
+	} else if (HAS_NOTE(r)) {
+		o = emit_op(o, PIS_OP_FORGET_EFFECT, 0, 0);
+		o = (gain == PIS_NONE)
+		  ? emit_op(o, PIS_OP_RESTORE_LEVEL, 0, 0)
+		  : emit_op(o, PIS_OP_VOICE_LEVEL, 0, gain);
+		o = emit_op(o, PIS_OP_NOTE, r->note, r->octave);
+	} else {
+		if (gain != PIS_NONE) {
+			o = emit_op(o, PIS_OP_VOICE_LEVEL, 0, gain);
+		}
+		o = emit_op(o, PIS_OP_END_ARPEGGIO, 0, 0);
+	}
+
+	switch (EFFECT_HI(r)) {
+		case 0x00:
+			o = EFFECT_LO(r)
+			  ? emit_op(o, PIS_OP_ARPEGGIO, 0, r->effect)
+			  : emit_op(o, PIS_OP_ARPEGGIO_OFF, 0, 0);
+			break;
+		case 0x01:
+			o = emit_op(o, PIS_OP_SLIDE, 0, EFFECT_LO(r));
+			break;
+		case 0x02:
+			o = emit_op(o, PIS_OP_SLIDE, 0, - EFFECT_LO(r));
+			break;
+		case 0x03:
+			o = emit_op(o, PIS_OP_PORTA, 0, EFFECT_LO(r));
+			break;
+		case 0x0b:
+			o = emit_op(o, PIS_OP_POSITION_JUMP, 0, r->effect);
+			break;
+		case 0x0d:
+			o = emit_op(o, PIS_OP_PATTERN_BREAK, 0, r->effect);
+			break;
+		case 0x0e:
+			if (EFFECT_MIDNIB(r) == 0x06) {
+				o = emit_op(o, PIS_OP_LOOP, 0, r->effect);
+			} else if (EFFECT_MIDNIB(r) == 0x0a || EFFECT_MIDNIB(r) == 0x0b) {
+				o = emit_op(o, PIS_OP_VOLUME_SLIDE, 0, r->effect);
+			}
+			break;
+		case 0x0f:
+			o = emit_op(o, PIS_OP_SPEED, 0, r->effect);
+			break;
+	}
+
+	o = r->effect
+	  ? emit_op(o, PIS_OP_EFFECT, 0, r->effect)
+	  : emit_op(o, PIS_OP_NO_EFFECT, 0, 0);
+	o = emit_op(o, PIS_OP_END, 0, 0);
+	return o - op;
+}
+
+
+PisOp *emit_op(PisOp *o, int op, int a, int b) {
+	o->op = op;
+	o->a = a;
+	o->b = b;
+	return o + 1;
+}
+
+
+// replay_voice on the compiled rows. The handlers that take a row get
+// one holding just the effect operand.
+void replay_voice_compiled(PisPlayer *p, int v, int pattern, int row) {
+	PisVoiceState *vs = &p->replay_state.voice_state[v];
+	PisRowUnpacked r;
+	PisOp *op;
+
+	if (row < 0 || row >= 64) {
+		//
+		// Row outside the pattern data, left to the interpreter
+		//
+		replay_voice(p, v);
+		return;
+	}
+
+	for (op = &p->program->op[ p->program->start[pattern][row] ]; op->op != PIS_OP_END; op++) {
+		r.effect = op->b;
+		switch (op->op) {
+			case PIS_OP_PORTA_INSTRUMENT:
+				replay_set_instrument(p, v, op->a);
+				if (vs->volume < 63) {
+					replay_set_level(p, v, op->a, PIS_NONE, 0);
+				}
+				break;
+			case PIS_OP_PORTA_TARGET:
+				vs->porta_src_freq = vs->frequency;
+				vs->porta_src_octave = vs->octave;
+				vs->porta_dest_freq = frequency_table[ op->a ];
+				vs->porta_dest_octave = op->b;
+				if (vs->porta_dest_octave < vs->octave) {
+					vs->porta_sign = -1;
+				} else if (vs->porta_dest_octave > vs->octave) {
+					vs->porta_sign = 1;
+				} else {
+					vs->porta_sign = (vs->porta_dest_freq < vs->frequency)
+								   ? -1
+								   : 1;
+				}
+				break;
+			case PIS_OP_NOTE_OFF:
+				vs->previous_effect = PIS_NONE;
+				opl_note_off(p, v);
+				break;
+			case PIS_OP_INSTRUMENT:
+				if (op->a != vs->instrument) {
+					replay_set_instrument(p, v, op->a);
+				} else if (vs->volume < 63) {
+					replay_set_level(p, v, op->a, PIS_NONE, 0);
+				}
+				break;
+			case PIS_OP_NEW_INSTRUMENT:
+				if (op->a != vs->instrument) {
+					replay_set_instrument(p, v, op->a);
+				}
+				break;
+			case PIS_OP_LEVEL:
+				replay_set_level(p, v, op->a, op->b, 1);
+				break;
+			case PIS_OP_SWITCH_INSTRUMENT:
+				if (op->a != vs->instrument) {
+					replay_set_instrument(p, v, op->a);
+					if (op->b != PIS_NONE) {
+						replay_set_level(p, v, op->a, op->b, 1);
+					} else if (vs->volume < 63) {
+						replay_set_level(p, v, op->a, PIS_NONE, 0);
+					}
+					if ((vs->previous_effect != PIS_NONE) && ((vs->previous_effect & 0xF00) == 0)) {
+						opl_set_pitch(p, v, vs->frequency, vs->octave);
+					}
+				}
+				break;
+			case PIS_OP_FORGET_EFFECT:
+				vs->previous_effect = PIS_NONE;
+				break;
+			case PIS_OP_VOICE_LEVEL:
+				if (vs->instrument != PIS_NONE) {
+					replay_set_level(p, v, vs->instrument, op->b, 1);
+				}
+				break;
+			case PIS_OP_RESTORE_LEVEL:
+				if (vs->instrument != PIS_NONE && vs->volume < 63) {
+					replay_set_level(p, v, vs->instrument, PIS_NONE, 0);
+				}
+				break;
+			case PIS_OP_NOTE:
+				vs->note = op->a;
+				vs->octave = op->b;
+				vs->frequency = frequency_table[ op->a ];
+				opl_set_pitch(p, v, vs->frequency, vs->octave);
+				break;
+			case PIS_OP_END_ARPEGGIO:
+				if ((vs->previous_effect != PIS_NONE) && ((vs->previous_effect & 0xF00) == 0)) {
+					opl_set_pitch(p, v, vs->frequency, vs->octave);
+				}
+				break;
+			case PIS_OP_ARPEGGIO:
+				replay_handle_arpeggio(p, v, vs, &r);
+				break;
+			case PIS_OP_ARPEGGIO_OFF:
+				vs->arpeggio_flag = 0;
+				break;
+			case PIS_OP_SLIDE:
+				vs->slide_increment = op->b;
+				break;
+			case PIS_OP_PORTA:
+				replay_set_voice_volatiles(p, v, 0, 0, op->b);
+				break;
+			case PIS_OP_POSITION_JUMP:
+				replay_handle_posjmp(p, v, &r);
+				break;
+			case PIS_OP_PATTERN_BREAK:
+				replay_handle_ptnbreak(p, v, &r);
+				break;
+			case PIS_OP_LOOP:
+				replay_handle_loop(p, v, &r);
+				break;
+			case PIS_OP_VOLUME_SLIDE:
+				replay_handle_volume_slide(p, v, vs, &r);
+				break;
+			case PIS_OP_SPEED:
+				replay_handle_speed(p, v, &r);
+				break;
+			case PIS_OP_EFFECT:
+				vs->previous_effect = op->b;
+				break;
+			case PIS_OP_NO_EFFECT:
+				vs->previous_effect = PIS_NONE;
+				replay_reset_voice(p, v);
+				break;
+		}
+	}
+}
+
+
+void replay_enter_row_with_portamento(PisPlayer *p, int v, PisVoiceState *vs, PisRowUnpacked *r) {
 	if (HAS_INSTRUMENT(r)) {
-		replay_set_instrument(v, r->instrument);
+		replay_set_instrument(p, v, r->instrument);
 		if (vs->volume < 63) {
-			replay_set_level(v, r->instrument, PIS_NONE, 0);
+			replay_set_level(p, v, r->instrument, PIS_NONE, 0);
 		}
 	}
 	if (HAS_NOTE(r)) {
@@ -180,11 +1522,11 @@ void replay_enter_row_with_portamento(int v, PisVoiceState *vs, PisRowUnpacked *
 }
 
 
-void replay_enter_row_with_instrument_and_note(int v, PisVoiceState *vs, PisRowUnpacked *r) {
+void replay_enter_row_with_instrument_and_note(PisPlayer *p, int v, PisVoiceState *vs, PisRowUnpacked *r) {
 
 	vs->previous_effect = PIS_NONE;
 	
-	opl_note_off(v);
+	opl_note_off(p, v);
 	if (EFFECT_HI(r) != 0x0c) {
 		//
 		// Volume is not set
@@ -193,9 +1535,9 @@ void replay_enter_row_with_instrument_and_note(int v, PisVoiceState *vs, PisRowU
 			//
 			// Is new instrument
 			//
-			replay_set_instrument(v, r->instrument);
+			replay_set_instrument(p, v, r->instrument);
 		} else if (vs->volume < 63) {
-			replay_set_level(v, r->instrument, PIS_NONE, 0);
+			replay_set_level(p, v, r->instrument, PIS_NONE, 0);
 		}
 			
 	} else {
@@ -206,45 +1548,45 @@ void replay_enter_row_with_instrument_and_note(int v, PisVoiceState *vs, PisRowU
 			//
 			// Is new instrument
 			//
-			replay_set_instrument(v, r->instrument);
+			replay_set_instrument(p, v, r->instrument);
 		}
-		replay_set_level(v, r->instrument, EFFECT_LO(r), 1);
+		replay_set_level(p, v, r->instrument, EFFECT_LO(r), 1);
 	}
 	//
 	// Trigger new note
 	//
-	replay_set_note(v, vs, r);
+	replay_set_note(p, v, vs, r);
 }
 
 
-void replay_enter_row_with_instrument_only(int v, PisVoiceState *vs, PisRowUnpacked *r) {
+void replay_enter_row_with_instrument_only(PisPlayer *p, int v, PisVoiceState *vs, PisRowUnpacked *r) {
 	
 	if (r->instrument != vs->instrument) {
 		//
 		// Is new instrument
 		//
-		replay_set_instrument(v, r->instrument);
+		replay_set_instrument(p, v, r->instrument);
 		
 		//
 		// Set operator level according to instrument and possibly Cxx effect
 		//
 		if (EFFECT_HI(r) == 0x0c) {
-			replay_set_level(v, r->instrument, EFFECT_LO(r), 1);
+			replay_set_level(p, v, r->instrument, EFFECT_LO(r), 1);
 		} else if (vs->volume < 63) {
-			replay_set_level(v, r->instrument, PIS_NONE, 0);
+			replay_set_level(p, v, r->instrument, PIS_NONE, 0);
 		}
 		
 		if ((vs->previous_effect != PIS_NONE) && ((vs->previous_effect & 0xF00) == 0)) {
 			//
 			// Reset to base tone after arpeggio
 			//
-			opl_set_pitch(v, vs->frequency, vs->octave);
+			opl_set_pitch(p, v, vs->frequency, vs->octave);
 		}
 	}	
 }
 
 
-void replay_enter_row_with_note_only(int v, PisVoiceState *vs, PisRowUnpacked *r) {
+void replay_enter_row_with_note_only(PisPlayer *p, int v, PisVoiceState *vs, PisRowUnpacked *r) {
 	
 	vs->previous_effect = PIS_NONE;
 
@@ -253,42 +1595,42 @@ void replay_enter_row_with_note_only(int v, PisVoiceState *vs, PisRowUnpacked *r
 		// Set operator level according to instrument and possibly Cxx effect
 		//
 		if (EFFECT_HI(r) == 0x0c) {
-			replay_set_level(v, vs->instrument, EFFECT_LO(r), 1);
+			replay_set_level(p, v, vs->instrument, EFFECT_LO(r), 1);
 		} else if (vs->volume < 63) {
-			replay_set_level(v, vs->instrument, PIS_NONE, 0);
+			replay_set_level(p, v, vs->instrument, PIS_NONE, 0);
 		}		
 	}
 	//
 	// Trigger new note
 	//
-	replay_set_note(v, vs, r);	
+	replay_set_note(p, v, vs, r);	
 }
 
 
-void replay_enter_row_with_possibly_effect_only(int v, PisVoiceState *vs, PisRowUnpacked *r) {
+void replay_enter_row_with_possibly_effect_only(PisPlayer *p, int v, PisVoiceState *vs, PisRowUnpacked *r) {
 		
 	//
 	// Set operator level according to instrument and Cxx effect
 	//
 	if (vs->instrument != PIS_NONE && EFFECT_HI(r) == 0x0c) {
-		replay_set_level(v, vs->instrument, EFFECT_LO(r), 1);
+		replay_set_level(p, v, vs->instrument, EFFECT_LO(r), 1);
 	}
 
 	if ((vs->previous_effect != PIS_NONE) && ((vs->previous_effect & 0xF00) == 0)) {
 		//
 		// Reset to base tone after arpeggio
 		//
-		opl_set_pitch(v, vs->frequency, vs->octave);
+		opl_set_pitch(p, v, vs->frequency, vs->octave);
 	}	
 }
 
 
-void replay_handle_effect(int v, PisVoiceState *vs, PisRowUnpacked *r) {
+void replay_handle_effect(PisPlayer *p, int v, PisVoiceState *vs, PisRowUnpacked *r) {
 	int effect_hi = EFFECT_HI(r);
 	switch (effect_hi) {
 		case 0x00: // arpeggio
 			if (EFFECT_LO(r)) {
-				replay_handle_arpeggio(v, vs, r);
+				replay_handle_arpeggio(p, v, vs, r);
 			} else {
 				vs->arpeggio_flag = 0;
 			}
@@ -300,40 +1642,40 @@ void replay_handle_effect(int v, PisVoiceState *vs, PisRowUnpacked *r) {
 			vs->slide_increment = - EFFECT_LO(r);
 			break;
 		case 0x03: // tone portamento
-			replay_set_voice_volatiles(v, 0, 0, EFFECT_LO(r));
+			replay_set_voice_volatiles(p, v, 0, 0, EFFECT_LO(r));
 			break;
 		case 0x0b: // position jump
-			replay_handle_posjmp(v, r);
+			replay_handle_posjmp(p, v, r);
 			break;
 		case 0x0d: // pattern break
-			replay_handle_ptnbreak(v, r);
+			replay_handle_ptnbreak(p, v, r);
 			break;
 		case 0x0e: // Exx commands
-			replay_handle_exx_command(v, vs, r);
+			replay_handle_exx_command(p, v, vs, r);
 			break;
 		case 0x0f: // set speed
-			replay_handle_speed(v, r);
+			replay_handle_speed(p, v, r);
 			break;
 	}
 }
 
 
-void replay_handle_exx_command(int v, PisVoiceState *vs, PisRowUnpacked *r) {
+void replay_handle_exx_command(PisPlayer *p, int v, PisVoiceState *vs, PisRowUnpacked *r) {
 	switch (EFFECT_MIDNIB(r)) {
 		case 0x06: // loop
-			replay_handle_loop(v, r);
+			replay_handle_loop(p, v, r);
 			break;
 		case 0x0a: // volume slide up
 		case 0x0b: // volume slide down
-			replay_handle_volume_slide(v, vs, r);
+			replay_handle_volume_slide(p, v, vs, r);
 			break;
 	}
 }
 
 
-void replay_handle_loop(int v, PisRowUnpacked *r) {
+void replay_handle_loop(PisPlayer *p, int v, PisRowUnpacked *r) {
 	
-	if ( ! replay_state.loop_flag) {
+	if ( ! p->replay_state.loop_flag) {
 		//
 		// Playing for the first time
 		//
@@ -341,32 +1683,32 @@ void replay_handle_loop(int v, PisRowUnpacked *r) {
 			//
 			// Set loop start row
 			//
-			replay_state.loop_start_row = replay_state.row;
+			p->replay_state.loop_start_row = p->replay_state.row;
 		} else {
 			//
 			// Initialize loop counter
 			//
-			replay_state.loop_count = EFFECT_LONIB(r);
-			replay_state.loop_flag = 1;
+			p->replay_state.loop_count = EFFECT_LONIB(r);
+			p->replay_state.loop_flag = 1;
 		}
 	}
 	
-	if ((replay_state.loop_flag) && (EFFECT_LONIB(r))) {
+	if ((p->replay_state.loop_flag) && (EFFECT_LONIB(r))) {
 		//
 		// Repeating
 		//
-		replay_state.loop_count--;
+		p->replay_state.loop_count--;
 		
-		if (replay_state.loop_count >= 0) {
-			replay_state.row = replay_state.loop_start_row - 1;
+		if (p->replay_state.loop_count >= 0) {
+			p->replay_state.row = p->replay_state.loop_start_row - 1;
 		} else {
-			replay_state.loop_flag = 0;
+			p->replay_state.loop_flag = 0;
 		}
 	}
 }
 
 
-void replay_handle_volume_slide(int v, PisVoiceState *vs, PisRowUnpacked *r) {
+void replay_handle_volume_slide(PisPlayer *p, int v, PisVoiceState *vs, PisRowUnpacked *r) {
 	int level;
 	
 	if (vs->instrument != PIS_NONE) {
@@ -379,33 +1721,33 @@ void replay_handle_volume_slide(int v, PisVoiceState *vs, PisRowUnpacked *r) {
 		else if (level > 63)
 			level = 63;
 			
-		replay_set_level(v, vs->instrument, level, 0);	
+		replay_set_level(p, v, vs->instrument, level, 0);	
 	}	
 }
 
 
-void replay_do_per_frame_effects() {
+void replay_do_per_frame_effects(PisPlayer *p) {
 
-	replay_state.arpeggio_index++;
-	if (replay_state.arpeggio_index == 3) replay_state.arpeggio_index = 0;
+	p->replay_state.arpeggio_index++;
+	if (p->replay_state.arpeggio_index == 3) p->replay_state.arpeggio_index = 0;
 
 	for (int v=0; v<8; v++) {
-		PisVoiceState *vs = &replay_state.voice_state[ v ];
+		PisVoiceState *vs = &p->replay_state.voice_state[ v ];
 		if (vs->slide_increment) {
 			vs->frequency += vs->slide_increment;
-			opl_set_pitch(v, vs->frequency, vs->octave);						
+			opl_set_pitch(p, v, vs->frequency, vs->octave);						
 		} else if (vs->porta_increment) {
-			replay_do_per_frame_portamento(v, vs);
+			replay_do_per_frame_portamento(p, v, vs);
 		} else if (vs->arpeggio_flag) {
-			int freq = vs->arpeggio_freq[ replay_state.arpeggio_index ];
-			opl_set_pitch(v, freq, vs->arpeggio_octave[ replay_state.arpeggio_index ]);
+			int freq = vs->arpeggio_freq[ p->replay_state.arpeggio_index ];
+			opl_set_pitch(p, v, freq, vs->arpeggio_octave[ p->replay_state.arpeggio_index ]);
 		}		
 	}
 				
 }
 
 
-void replay_do_per_frame_portamento(int v, PisVoiceState *vs) {	
+void replay_do_per_frame_portamento(PisPlayer *p, int v, PisVoiceState *vs) {	
 	if (vs->porta_sign == 1) {
 		vs->frequency += vs->porta_increment;
 		if ((vs->octave == vs->porta_dest_octave) && (vs->frequency > vs->porta_dest_freq)) {
@@ -427,11 +1769,11 @@ void replay_do_per_frame_portamento(int v, PisVoiceState *vs) {
 			vs->octave--;
 		}
 	}
-	opl_set_pitch(v, vs->frequency, vs->octave);
+	opl_set_pitch(p, v, vs->frequency, vs->octave);
 }
 
 
-void replay_handle_arpeggio(int v, PisVoiceState *vs, PisRowUnpacked *r) {
+void replay_handle_arpeggio(PisPlayer *p, int v, PisVoiceState *vs, PisRowUnpacked *r) {
 	int an1, an2;
 	if (EFFECT_LO(r) != (vs->previous_effect & 0xff)) {
 		vs->arpeggio_freq[0] = frequency_table[ vs->note ];
@@ -460,47 +1802,47 @@ void replay_handle_arpeggio(int v, PisVoiceState *vs, PisRowUnpacked *r) {
 }
 
 
-void replay_handle_posjmp(int v, PisRowUnpacked *r) {
-	replay_reset_voice(v);
-	replay_state.position_jump = EFFECT_LO(r);
+void replay_handle_posjmp(PisPlayer *p, int v, PisRowUnpacked *r) {
+	replay_reset_voice(p, v);
+	p->replay_state.position_jump = EFFECT_LO(r);
 }
 
 
-void replay_handle_ptnbreak(int v, PisRowUnpacked *r) {
-	replay_reset_voice(v);
-	replay_state.pattern_break = EFFECT_LO(r);
+void replay_handle_ptnbreak(PisPlayer *p, int v, PisRowUnpacked *r) {
+	replay_reset_voice(p, v);
+	p->replay_state.pattern_break = EFFECT_LO(r);
 }
 
 
-void replay_handle_speed(int v, PisRowUnpacked *r) {
-	replay_reset_voice(v);
+void replay_handle_speed(PisPlayer *p, int v, PisRowUnpacked *r) {
+	replay_reset_voice(p, v);
 	if (EFFECT_LO(r)) {
-		replay_state.speed = EFFECT_LO(r);
+		p->replay_state.speed = EFFECT_LO(r);
 	} else {
-		is_playing = 0;
+		p->is_playing = 0;
 	}
 }
 
 
-void replay_set_note(int v, PisVoiceState *vs, PisRowUnpacked *r) {
+void replay_set_note(PisPlayer *p, int v, PisVoiceState *vs, PisRowUnpacked *r) {
 	int frequency = frequency_table[ r->note ];
-	opl_set_pitch(v, frequency, r->octave);
+	opl_set_pitch(p, v, frequency, r->octave);
 	vs->note = r->note;
 	vs->octave = r->octave;
 	vs->frequency = frequency;
 }
 
 
-void replay_set_instrument(int v, int instr_index) {
-	PisInstrument *pinstr = &module.instrument[ instr_index ];
-	opl_set_instrument(v, pinstr);
-	replay_state.voice_state[v].instrument = instr_index;
+void replay_set_instrument(PisPlayer *p, int v, int instr_index) {
+	PisInstrument *pinstr = PIS_INSTRUMENT(&p->module, instr_index);
+	opl_set_instrument(p, v, pinstr);
+	p->replay_state.voice_state[v].instrument = instr_index;
 }
 
 
-void replay_set_level(int v, int instr_index, int gain, int do_apply_correction) {
+void replay_set_level(PisPlayer *p, int v, int instr_index, int gain, int do_apply_correction) {
 	int base, l1, l2;
-	PisInstrument *instr = &module.instrument[ instr_index ];
+	PisInstrument *instr = PIS_INSTRUMENT(&p->module, instr_index);
 	
 	base = do_apply_correction
 	     ? 62
@@ -508,195 +1850,498 @@ void replay_set_level(int v, int instr_index, int gain, int do_apply_correction)
 
 	if (gain == PIS_NONE) {
 		gain = 64;
-		replay_state.voice_state[ v ].volume = 63;
+		p->replay_state.voice_state[ v ].volume = 63;
 	} else {
-		replay_state.voice_state[ v ].volume = gain;
+		p->replay_state.voice_state[ v ].volume = gain;
 	}
 	     
 	l1 = base - (gain * (64 - instr->lev1) >> 6);
 	l2 = base - (gain * (64 - instr->lev2) >> 6);
 	
-	oplout(0x40 + opl_voice_offset_into_registers[ v ], l1);
-	oplout(0x43 + opl_voice_offset_into_registers[ v ], l2);
+	oplout(p, 0x40 + opl_voice_offset_into_registers[ v ], l1);
+	oplout(p, 0x43 + opl_voice_offset_into_registers[ v ], l2);
 }
 
 
-void replay_set_voice_volatiles(int v, int arpeggio_flag, int slide_increment, int porta_increment) {
-	PisVoiceState *vs = &replay_state.voice_state[v];
+void replay_set_voice_volatiles(PisPlayer *p, int v, int arpeggio_flag, int slide_increment, int porta_increment) {
+	PisVoiceState *vs = &p->replay_state.voice_state[v];
 	vs->arpeggio_flag = arpeggio_flag;
 	vs->slide_increment = slide_increment;
 	vs->porta_increment = porta_increment;
 }
 
 
-void unpack_row() {
-	int pattern_index;
-	uint32_t *pptn;
-	uint32_t packed;
-	uint8_t b1, b2, el;
-	int note, octave, instrument, effect;
+void unpack_row(PisPlayer *p) {
+	PisReplayState *s = &p->replay_state;
+	uint8_t *order = PIS_ORDER(&p->module, s->position);
 	
 	for (int v=0; v<9; v++) {
-		pattern_index = module.order[ replay_state.position ][ v ];
-		pptn = module.pattern[ pattern_index ];
-		packed = pptn[ replay_state.row ];
-
-		el = packed & 0xff;  packed >>= 8;
-		b2 = packed & 0xff;  packed >>= 8;
-		b1 = packed & 0xff;
-	
-		replay_state.row_buffer[v].note = b1 >> 4;
-		replay_state.row_buffer[v].octave = (b1 >> 1) & 7;
-		replay_state.row_buffer[v].instrument = ((b1 & 1) << 4) | (b2 >> 4);
-		replay_state.row_buffer[v].effect = ((b2 & 15) << 8) | el;	
+		s->row_buffer[v] = (unsigned)s->row < 64
+						 ? p->module.pattern[ order[v] ][ s->row ]
+						 : p->module.pattern[ p->module.number_of_patterns ][0];
 	}
 }
 
-void advance_row() {
-	if (replay_state.position_jump >= 0) {
-		replay_state.position = replay_state.position_jump;
-		if (replay_state.pattern_break == PIS_NONE) {
+void advance_row(PisPlayer *p) {
+	if (p->replay_state.position_jump >= 0) {
+		p->replay_state.position = p->replay_state.position_jump;
+		if (p->replay_state.pattern_break == PIS_NONE) {
 			//
 			// Position jump without pattern break
 			//
-			replay_state.row = 0;			
+			p->replay_state.row = 0;			
 		}
 		else {
 			//
 			// Position jump with pattern break
 			//
-			replay_state.row = replay_state.pattern_break;
-			replay_state.pattern_break = PIS_NONE;
+			p->replay_state.row = p->replay_state.pattern_break;
+			p->replay_state.pattern_break = PIS_NONE;
 		}
-		replay_state.position_jump = PIS_NONE;
+		p->replay_state.position_jump = PIS_NONE;
 	}
-	else if (replay_state.pattern_break >= 0) {
+	else if (p->replay_state.pattern_break >= 0) {
 		//
 		// Pattern break
 		//
-		replay_state.position++;
-		if (replay_state.position == module.length) {
-			replay_state.position = 0;
+		p->replay_state.position++;
+		if (p->replay_state.position == p->module.length) {
+			p->replay_state.position = 0;
 		}
-		replay_state.row = replay_state.pattern_break;
-		replay_state.pattern_break = PIS_NONE;
+		p->replay_state.row = p->replay_state.pattern_break;
+		p->replay_state.pattern_break = PIS_NONE;
 	}
 	else {
 		//
 		// Simple row advance
 		//
-		replay_state.row++;
-		if (replay_state.row == 64) {
-			replay_state.row = 0;
-			replay_state.position++;
-			if (replay_state.position == module.length) {
-				replay_state.position = 0;
+		p->replay_state.row++;
+		if (p->replay_state.row == 64) {
+			p->replay_state.row = 0;
+			p->replay_state.position++;
+			if (p->replay_state.position == p->module.length) {
+				p->replay_state.position = 0;
 			}
 		}
 	}
 	
-	replay_state.count = 0;
+	p->replay_state.count = 0;
 }
 
 
-void load_module(const char *path, PisModule *pmodule) {
-	int i, j;
-	
-	memset(pmodule, 0, sizeof(PisModule));
+// The whole file in one read, then parsed from memory
+int load_module(const char *path, PisModule *pmodule) {
+	uint8_t *data;
+	size_t size;
+	int result = read_file(path, &data, &size);
+	if (result == PIS_OK) {
+		result = load_module_from_memory(pmodule, data, size);
+		free(data);
+	}
+	return result;
+}
+
+
+int read_file(const char *path, uint8_t **pdata, size_t *psize) {
 	FILE *f = fopen(path, "rb");
-	assert(f);
-	
-	pmodule->length = readb(f);
-	pmodule->number_of_patterns = readb(f);
-	pmodule->number_of_instruments = readb(f);
-	
-	for (i=0; i<pmodule->number_of_patterns; i++) {
-		pmodule->pattern_map[i] = readb(f);
+	uint8_t *data = NULL;
+	long size;
+	int result = PIS_ERROR_FILE;
+
+	if (!f) {
+		return PIS_ERROR_FILE;
+	}
+	if (fseek(f, 0, SEEK_END) == 0 && (size = ftell(f)) >= 0 && fseek(f, 0, SEEK_SET) == 0) {
+		data = malloc(size ? size : 1);
+		if (!data) {
+			result = PIS_ERROR_MEMORY;
+		} else if (fread(data, 1, size, f) == (size_t)size) {
+			*pdata = data;
+			*psize = size;
+			data = NULL;
+			result = PIS_OK;
+		}
 	}
+	free(data);
+	fclose(f);
+	return result;
+}
 
-	for (i=0; i<pmodule->number_of_instruments; i++) {
-		pmodule->instrument_map[i] = readb(f);
+
+// Read-only view of a whole file: 1 when mapped, 0 when read into
+// memory where mmap is missing or fails, PIS_NONE when unreadable
+int map_file(const char *path, const uint8_t **pdata, size_t *psize) {
+	uint8_t *data;
+#ifdef PIS_HAVE_MMAP
+	int fd = open(path, O_RDONLY);
+	struct stat st;
+	if (fd >= 0 && fstat(fd, &st) == 0 && st.st_size > 0) {
+		void *mapping = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+		if (mapping != MAP_FAILED) {
+			close(fd);
+			*pdata = mapping;
+			*psize = st.st_size;
+			return 1;
+		}
 	}
+	if (fd >= 0) {
+		close(fd);
+	}
+#endif
+	if (read_file(path, &data, psize) != PIS_OK) {
+		return PIS_NONE;
+	}
+	*pdata = data;
+	return 0;
+}
 
-	fread(pmodule->order, 1, 9 * pmodule->length, f);
-	
-	for (i=0; i<pmodule->number_of_patterns; i++) {
-		j = pmodule->pattern_map[i];
-		load_pattern(pmodule->pattern[j], f);
-	}	
 
-	for (i=0; i<pmodule->number_of_instruments; i++) {
-		j = pmodule->instrument_map[i];
-		load_instrument(&pmodule->instrument[j], f);
+void unmap_file(const uint8_t *data, size_t size, int mapped) {
+#ifdef PIS_HAVE_MMAP
+	if (mapped) {
+		munmap((void *)data, size);
+		return;
+	}
+#endif
+	free((void *)data);
+}
+
+
+//
+// Every count and index is checked against the buffer and the format's
+// limits before anything is allocated; pmodule is only written on
+// success. The pattern rows and instruments are decoded straight from
+// the buffer.
+//
+int load_module_from_memory(PisModule *pmodule, const void *data, size_t size) {
+	const uint8_t *b = data;
+	const uint8_t *pattern_map, *instrument_map, *order, *patterns, *instruments;
+	uint8_t pattern_slot[128];
+	int length, number_of_patterns, number_of_instruments, i, v;
+	PisModule m;
+
+	if (size < 3) {
+		return PIS_ERROR_TRUNCATED;
+	}
+	length = b[0];
+	number_of_patterns = b[1];
+	number_of_instruments = b[2];
+	if (number_of_patterns > 128 || number_of_instruments > 32) {
+		return PIS_ERROR_RANGE;
+	}
+
+	if (size < 3 + number_of_patterns * (1 + PIS_PATTERN_BYTES)
+			 + number_of_instruments * (1 + PIS_INSTRUMENT_BYTES) + 9 * length) {
+		return PIS_ERROR_TRUNCATED;
+	}
+	pattern_map = b + 3;
+	instrument_map = pattern_map + number_of_patterns;
+	order = instrument_map + number_of_instruments;
+	patterns = order + 9 * length;
+	instruments = patterns + number_of_patterns * PIS_PATTERN_BYTES;
+
+	for (i=0; i<number_of_patterns; i++) {
+		if (pattern_map[i] >= 128) return PIS_ERROR_RANGE;
+	}
+	for (i=0; i<number_of_instruments; i++) {
+		if (instrument_map[i] >= 64) return PIS_ERROR_RANGE;
+	}
+	for (i=0; i<9 * length; i++) {
+		if (order[i] >= 128) return PIS_ERROR_RANGE;
+	}
+
+	alloc_module(&m, length, number_of_patterns, number_of_instruments);
+	if (!m.arena) {
+		return PIS_ERROR_MEMORY;
+	}
+
+	//
+	// Patterns missing from the file play the empty spare pattern. The
+	// position past the end of the order list plays pattern 0, which is
+	// the spare only when the file has no pattern 0
+	//
+	memset(pattern_slot, number_of_patterns, sizeof(pattern_slot));
+	for (i=0; i<number_of_patterns; i++) {
+		pattern_slot[ pattern_map[i] ] = i;
+	}
+	for (i=0; i<=length; i++) {
+		for (v=0; v<9; v++) {
+			m.order[i][v] = (i < length)
+						  ? pattern_slot[ order[i * 9 + v] ]
+						  : pattern_slot[0];
+		}
+	}
+
+	for (i=0; i<number_of_patterns; i++) {
+		load_pattern(m.pattern[i], patterns + i * PIS_PATTERN_BYTES);
+	}
+
+	// Rows address 32 instruments, the ones mapped above are never played
+	memset(m.instrument_slot, number_of_instruments, sizeof(m.instrument_slot));
+	for (i=0; i<number_of_instruments; i++) {
+		if (instrument_map[i] < 32) {
+			m.instrument_slot[ instrument_map[i] ] = i;
+		}
+		load_instrument(&m.instrument[i], instruments + i * PIS_INSTRUMENT_BYTES);
+	}
+
+	*pmodule = m;
+	return PIS_OK;
+}
+
+
+//
+// One zeroed block: patterns, instruments, order list, each with a spare
+// entry at the end. The layout follows from the counts alone.
+//
+void alloc_module(PisModule *pmodule, int length, int number_of_patterns, int number_of_instruments) {
+	size_t size = module_arena_size(length, number_of_patterns, number_of_instruments);
+	uint8_t *arena = calloc(1, size);
+
+	memset(pmodule, 0, sizeof(PisModule));
+	if (arena) {
+		layout_module(pmodule, arena, length, number_of_patterns, number_of_instruments);
+	}
+}
+
+
+size_t module_arena_size(int length, int number_of_patterns, int number_of_instruments) {
+	return (number_of_patterns + 1) * sizeof(PisRowUnpacked[64])
+		 + (number_of_instruments + 1) * sizeof(PisInstrument)
+		 + (length + 1) * sizeof(uint8_t[9]);
+}
+
+
+// Points the tables of pmodule into an arena of module_arena_size bytes
+void layout_module(PisModule *pmodule, void *arena, int length, int number_of_patterns, int number_of_instruments) {
+	uint8_t *b = arena;
+	pmodule->length = length;
+	pmodule->number_of_patterns = number_of_patterns;
+	pmodule->number_of_instruments = number_of_instruments;
+	pmodule->pattern = (void *)b;
+	b += (number_of_patterns + 1) * sizeof(*pmodule->pattern);
+	pmodule->instrument = (void *)b;
+	b += (number_of_instruments + 1) * sizeof(PisInstrument);
+	pmodule->order = (void *)b;
+	pmodule->arena = arena;
+	pmodule->arena_size = module_arena_size(length, number_of_patterns, number_of_instruments);
+}
+
+
+void copy_module(PisModule *destination, const PisModule *source) {
+	alloc_module(destination, source->length, source->number_of_patterns, source->number_of_instruments);
+	if (destination->arena) {
+		memcpy(destination->instrument_slot, source->instrument_slot, sizeof(source->instrument_slot));
+		memcpy(destination->arena, source->arena, source->arena_size);
 	}
-	
-	fclose(f);
 }
 
 
-void load_pattern(uint32_t *destination, FILE *f) {
+void free_module(PisModule *pmodule) {
+	if (!pmodule->borrowed) {
+		free(pmodule->arena);
+	}
+	memset(pmodule, 0, sizeof(PisModule));
+}
+
+
+// Rows are stored as three packed bytes, unpack them once here
+// instead of on every row of the replay
+void load_pattern(PisRowUnpacked *destination, const uint8_t *source) {
 	int row;
-	uint32_t packed;
-	for (row=0; row<64; row++) {
-		packed  = readb(f); packed <<= 8;
-		packed |= readb(f); packed <<= 8;
-		packed |= readb(f);
-		destination[row] = packed;
+	uint8_t b1, b2, el;
+	for (row=0; row<64; row++, source += 3) {
+		b1 = source[0];
+		b2 = source[1];
+		el = source[2];
+		destination[row].note = b1 >> 4;
+		destination[row].octave = (b1 >> 1) & 7;
+		destination[row].instrument = ((b1 & 1) << 4) | (b2 >> 4);
+		destination[row].effect = ((b2 & 15) << 8) | el;
+	}
+}
+
+
+void load_instrument(PisInstrument *pinstr, const uint8_t *source) {
+	pinstr->mul1 = source[0];  pinstr->mul2 = source[1];
+	pinstr->lev1 = source[2];  pinstr->lev2 = source[3];
+	pinstr->atd1 = source[4];  pinstr->atd2 = source[5];
+	pinstr->sur1 = source[6];  pinstr->sur2 = source[7];
+	pinstr->wav1 = source[8];  pinstr->wav2 = source[9];
+	pinstr->fbcon = source[10];
+}
+
+
+uint32_t cache_align(size_t offset) {
+	return (offset + PIS_CACHE_ALIGN - 1) & ~(size_t)(PIS_CACHE_ALIGN - 1);
+}
+
+
+// Zero padding up to offset from base, then the section; nonzero on error
+int write_cache_section(FILE *f, long base, uint32_t offset, const void *data, size_t size) {
+	static const uint8_t zero[PIS_CACHE_ALIGN];
+	long position = ftell(f) - base;
+	if (position < 0 || position > offset || offset - position > sizeof(zero)) {
+		return -1;
+	}
+	return fwrite(zero, 1, offset - position, f) != offset - position
+		|| fwrite(data, 1, size, f) != size;
+}
+
+
+// Checkpoints from frame 0 on in ascending frames, first entries inside
+// the tune
+int check_cached_seek_index(const PisCache *cache) {
+	const PisCacheHeader *h = cache->header;
+	const PisCheckpoint *checkpoint = (const PisCheckpoint *)(cache->data + h->checkpoint_offset);
+	const int32_t *first_entry = (const int32_t *)(cache->data + h->first_entry_offset);
+
+	if (h->length_frames < 0 || h->length_frames > PIS_SIMULATE_MAX_FRAMES
+		|| h->numcheckpoints < 1 || checkpoint[0].frame != 0) {
+		return 0;
+	}
+	for (int i=0; i<h->numcheckpoints; i++) {
+		if (!check_cached_checkpoint(&checkpoint[i], h->length_frames)
+			|| (i > 0 && checkpoint[i].frame <= checkpoint[i - 1].frame)) {
+			return 0;
+		}
+	}
+	for (int i=0; i<h->first_entry_positions * 64; i++) {
+		if (first_entry[i] != PIS_NONE && (first_entry[i] < 0 || first_entry[i] >= h->length_frames)) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+
+int cache_section_fits(const PisCache *cache, uint32_t offset, size_t size) {
+	return offset % PIS_CACHE_ALIGN == 0 && offset <= cache->size && size <= cache->size - offset;
+}
+
+
+// A cached module holds nothing load_module_from_memory could not have
+// decoded
+int check_cached_module(const PisModule *m) {
+	for (int i=0; i<=m->length; i++) {
+		for (int v=0; v<9; v++) {
+			if (m->order[i][v] > m->number_of_patterns) return 0;
+		}
 	}
+	for (int i=0; i<32; i++) {
+		if (m->instrument_slot[i] > m->number_of_instruments) return 0;
+	}
+	for (int i=0; i<=m->number_of_patterns; i++) {
+		for (int row=0; row<64; row++) {
+			if (!check_cached_row(&m->pattern[i][row])) return 0;
+		}
+	}
+	return 1;
+}
+
+
+int check_cached_row(const PisRowUnpacked *r) {
+	return r->effect <= 0xfff && r->note <= 15 && r->octave <= 7 && r->instrument <= 31;
 }
 
 
-void load_instrument(PisInstrument *pinstr, FILE *f) {
-	pinstr->mul1 = readb(f);  pinstr->mul2 = readb(f);
-	pinstr->lev1 = readb(f);  pinstr->lev2 = readb(f);
-	pinstr->atd1 = readb(f);  pinstr->atd2 = readb(f);
-	pinstr->sur1 = readb(f);  pinstr->sur2 = readb(f);
-	pinstr->wav1 = readb(f);  pinstr->wav2 = readb(f);
-	pinstr->fbcon = readb(f);
+//
+// A cached checkpoint holds a replay state linear playback can reach:
+// everything the replay uses as a table index in range, the frame
+// inside the tune
+//
+int check_cached_checkpoint(const PisCheckpoint *c, long length_frames) {
+	const PisReplayState *s = &c->replay_state;
+
+	if (c->frame < 0 || c->frame > length_frames
+		|| (c->is_playing != 0 && c->is_playing != 1)
+		|| s->speed < 1 || s->speed > 255 || s->count < 0 || s->count > 255
+		|| s->position < 0 || s->row < 0
+		|| s->position_jump < PIS_NONE || s->position_jump > 255
+		|| s->pattern_break < PIS_NONE || s->pattern_break > 255
+		|| s->arpeggio_index < 0 || s->arpeggio_index > 2
+		|| (s->loop_flag != 0 && s->loop_flag != 1)
+		|| s->loop_start_row < 0 || s->loop_count < PIS_NONE || s->loop_count > 15) {
+		return 0;
+	}
+	for (int v=0; v<9; v++) {
+		const PisVoiceState *vs = &s->voice_state[v];
+		if (vs->instrument < PIS_NONE || vs->instrument > 31
+			|| vs->note < 0 || vs->note > 11
+			|| !check_cached_row(&s->row_buffer[v])) {
+			return 0;
+		}
+	}
+	return 1;
 }
 
 
-void opl_set_pitch(int v, int freq, int octave) {
-	oplout(0xa0 + v, freq & 0xff);
-	oplout(0xb0 + v, 0x20 | (octave << 2) | (freq >> 8));
+void opl_set_pitch(PisPlayer *p, int v, int freq, int octave) {
+	oplout(p, 0xa0 + v, freq & 0xff);
+	oplout(p, 0xb0 + v, 0x20 | (octave << 2) | (freq >> 8));
 }
 
 
-void opl_note_off(int v) {
-	oplout(0xb0 + v, 0);
+void opl_note_off(PisPlayer *p, int v) {
+	oplout(p, 0xb0 + v, 0);
 }
 
 
-void opl_set_instrument(int v, PisInstrument *instr) { 
+void opl_set_instrument(PisPlayer *p, int v, PisInstrument *instr) { 
 	int opl_register = 0x20 + opl_voice_offset_into_registers[ v ];
-	oplout(opl_register, instr->mul1);  opl_register += 3;
-	oplout(opl_register, instr->mul2);  opl_register += 0x1d;
-	oplout(opl_register, instr->lev1);  opl_register += 3;
-	oplout(opl_register, instr->lev2);  opl_register += 0x1d;
-	oplout(opl_register, instr->atd1);  opl_register += 3;
-	oplout(opl_register, instr->atd2);  opl_register += 0x1d;
-	oplout(opl_register, instr->sur1);  opl_register += 3;
-	oplout(opl_register, instr->sur2);  opl_register += 0x5d;
-	oplout(opl_register, instr->wav1);  opl_register += 3;
-	oplout(opl_register, instr->wav2);  opl_register += 0x1d;
-	oplout(0xc0 + v, instr->fbcon);
+	oplout(p, opl_register, instr->mul1);  opl_register += 3;
+	oplout(p, opl_register, instr->mul2);  opl_register += 0x1d;
+	oplout(p, opl_register, instr->lev1);  opl_register += 3;
+	oplout(p, opl_register, instr->lev2);  opl_register += 0x1d;
+	oplout(p, opl_register, instr->atd1);  opl_register += 3;
+	oplout(p, opl_register, instr->atd2);  opl_register += 0x1d;
+	oplout(p, opl_register, instr->sur1);  opl_register += 3;
+	oplout(p, opl_register, instr->sur2);  opl_register += 0x5d;
+	oplout(p, opl_register, instr->wav1);  opl_register += 3;
+	oplout(p, opl_register, instr->wav2);  opl_register += 0x1d;
+	oplout(p, 0xc0 + v, instr->fbcon);
 }
 
 
-void oplout(int r, int v)
+// Register writes are queued at the time of the current replay frame
+void oplout(PisPlayer *p, int r, int v)
 {
-  OPLWrite(opl, 0, r);
-  OPLWrite(opl, 1, v);
+  p->opl_regs[r & 0xff] = v;
+  if (p->simulate) return;
+  if (OPLQueueWrite(p->opl, p->frame_time, r, v) != 0) p->error = PIS_ERROR_MEMORY;
+}
+
+
+// Reset the chip and write back the register file, key-on (0xB0-0xB8)
+// and rhythm (0xBD) last so notes start with their final sound
+void opl_load_registers(PisPlayer *p) {
+	uint8_t regs[256];
+	int r;
+
+	memcpy(regs, p->opl_regs, sizeof(regs));
+	OPLResetChip(p->opl);
+	p->frame_time = OPLGetTime(p->opl);
+	for (r=1; r<256; r++) {
+		if (regs[r] && !(r >= 0xb0 && r <= 0xbd)) {
+			oplout(p, r, regs[r]);
+		}
+	}
+	for (r=0xb0; r<=0xbd; r++) {
+		if (regs[r]) {
+			oplout(p, r, regs[r]);
+		}
+	}
 }
 
 
-void init_audio () {
+#ifndef PISPLAY_NO_SDL
+void init_audio (int samples) {
 	SDL_AudioSpec wanted;
 	SDL_memset(&wanted, 0, sizeof(wanted));
 	wanted.freq = 44100;
 	wanted.format = AUDIO_S16;
 	wanted.channels = 1;
-	wanted.samples = 16384;
+	wanted.samples = samples;
 	wanted.callback = audio_callback;
 	
 	int r = SDL_OpenAudio(&wanted, &obtainedAudioSpec);
@@ -710,59 +2355,181 @@ void init_audio () {
 	assert(obtainedAudioSpec.format == AUDIO_S16LSB ||
 		   obtainedAudioSpec.format == AUDIO_F32LSB);
 	assert(obtainedAudioSpec.channels <= 2);
-
-	samples_per_frame = obtainedAudioSpec.freq / 50;
 }
 
 
 void init_opl () {
-	opl = OPLCreate(OPL_TYPE_YM3812, OPL_MAGIC, obtainedAudioSpec.freq);
-	assert(opl);
-	oplout(1, 0x20); // enable waveform control
+	spare_player = pisplay_create(obtainedAudioSpec.freq);
+	assert(spare_player);
+}
+
+
+//
+// Audio side of the command queue, run at every frame boundary. A player
+// that cannot be handed back yet holds up the queue until it can.
+//
+void run_audio_commands() {
+	PisCommand command, retired;
+
+	retired.type = PIS_COMMAND_STOP;
+	retired.player = retiring_player;
+	if (retiring_player && pisplay_queue_push(&retired_players, &retired) == 0) {
+		retiring_player = NULL;
+	}
+
+	while (!retiring_player && pisplay_queue_pop(&audio_commands, &command) == 0) {
+		switch (command.type) {
+			case PIS_COMMAND_PLAY:
+			case PIS_COMMAND_STOP:
+				retired.player = sdl_player;
+				if (sdl_player && pisplay_queue_push(&retired_players, &retired) != 0) {
+					retiring_player = sdl_player;
+				}
+				sdl_player = command.player;
+				break;
+			case PIS_COMMAND_PAUSE:
+				audio_paused = command.value != 0;
+				break;
+			case PIS_COMMAND_SEEK:
+				if (sdl_player && sdl_player->seek_index) {
+					pisplay_seek_frame(sdl_player, command.frame);
+				}
+				break;
+			case PIS_COMMAND_GAIN:
+				audio_gain = command.value;
+				break;
+		}
+	}
+}
+
+
+// Of one sample frame in the device format
+int audio_bytes_per_sample() {
+	return (obtainedAudioSpec.format == AUDIO_F32LSB ? 4 : 2) * obtainedAudioSpec.channels;
+}
+
+
+//
+// Started before the device is unpaused, so that only the worker ever
+// renders. The ring holds at least two device buffers, a callback must
+// never find less than one in it.
+//
+int start_render_worker(int render_ahead_samples) {
+	Uint8 *block;
+
+	if (render_ahead_samples < 2 * obtainedAudioSpec.samples) {
+		render_ahead_samples = 2 * obtainedAudioSpec.samples;
+	}
+	render_ahead_bytes = render_ahead_samples * audio_bytes_per_sample();
+	// The worker owns its render block once it runs and frees it on exit
+	block = malloc(render_ahead_bytes);
+	if (!block) {
+		return -1;
+	}
+	if (pisplay_ring_init(&audio_ring, render_ahead_bytes) != 0) {
+		free(block);
+		return -1;
+	}
+	render_worker_wakeup = SDL_CreateSemaphore(0);
+	if (render_worker_wakeup) {
+		render_worker = SDL_CreateThread(render_worker_fn, "pisplay_audio", block);
+	}
+	if (!render_worker) {
+		if (render_worker_wakeup) SDL_DestroySemaphore(render_worker_wakeup);
+		pisplay_ring_free(&audio_ring);
+		free(block);
+		return -1;
+	}
+	return 0;
+}
+
+
+// Tops the ring up in one block whenever the callback has taken from it
+int render_worker_fn(void *data) {
+	int bytes_per_sample = audio_bytes_per_sample();
+	Uint8 *block = data;
+
+	while (!atomic_load(&render_worker_quit)) {
+		unsigned fill = pisplay_ring_fill(&audio_ring);
+		unsigned numbytes = fill < render_ahead_bytes ? render_ahead_bytes - fill : 0;
+
+		numbytes -= numbytes % bytes_per_sample;
+		if (numbytes) {
+			render_audio(block, numbytes);
+			pisplay_ring_write(&audio_ring, block, numbytes);
+		} else {
+			SDL_SemWaitTimeout(render_worker_wakeup, 10);
+		}
+	}
+	free(block);
+	return 0;
 }
 
 
 void audio_callback (void* userdata, Uint8* stream, int numbytes) {
+	if (render_worker) {
+		unsigned numread = pisplay_ring_read(&audio_ring, stream, numbytes);
+		memset(stream + numread, 0, numbytes - numread); // underrun
+		SDL_SemPost(render_worker_wakeup);
+		return;
+	}
+	render_audio(stream, numbytes);
+}
+
+
+//
+// Rendered a frame at a time, so that commands land on frame boundaries;
+// the output is the same as in one piece
+//
+void render_audio (Uint8* stream, int numbytes) {
 	
-	void (*audio_callback_inner)(void*, int) = NULL;
+	void (*audio_callback_inner)(PisPlayer*, void*, int) = NULL;
 
-	int numsamples_requested = obtainedAudioSpec.channels == 1
-				             ? numbytes >> 1
-			                 : numbytes >> 2;
-			                 
+	int bytes_per_sample = audio_bytes_per_sample();
+	int numsamples_requested = numbytes / bytes_per_sample;
 	int numbytes_chunk;
 
 	if (obtainedAudioSpec.format == AUDIO_F32LSB) {
-		numsamples_requested >>= 1;
 		audio_callback_inner = audio_callback_float;
 	} else {
 		audio_callback_inner = audio_callback_s16;
 	}
 
 	while (numsamples_requested) {
-		int numsamples_chunk = (numsamples_requested > frame_countdown)
-							 ? frame_countdown
-							 : numsamples_requested;
+		PisPlayer *p;
+		int numsamples_chunk;
+
+		run_audio_commands();
+		p = sdl_player;
+		if (!p || audio_paused || p->error) {
+			memset(stream, 0, numsamples_requested * bytes_per_sample);
+			return;
+		}
 
-		frame_countdown -= numsamples_chunk;
-		if (frame_countdown == 0) {
-			replay_frame_routine();
-			frame_countdown = samples_per_frame;
+		numsamples_chunk = (INT32)(p->frame_time - OPLGetTime(p->opl));
+		if (numsamples_chunk <= 0) {
+			numsamples_chunk = p->samples_per_frame;
+		}
+		if (numsamples_chunk > numsamples_requested) {
+			numsamples_chunk = numsamples_requested;
+		}
+		if (numsamples_chunk > FMOPL_OUTPUT_BUFFER_SIZE >> 1) {
+			numsamples_chunk = FMOPL_OUTPUT_BUFFER_SIZE >> 1;
 		}
-		
-		YM3812UpdateOne(opl, fmopl_output_buffer, numsamples_chunk);
 
-		if (obtainedAudioSpec.format == AUDIO_F32LSB) {
-			s16tofloat(fmopl_output_buffer, float_buffer, numsamples_chunk);
-			numbytes_chunk = numsamples_chunk << 2;
-		} else {
-			numbytes_chunk = numsamples_chunk << 1;
+		if (pisplay_render(p, p->fmopl_output_buffer, numsamples_chunk) != PIS_OK) {
+			// Register writes were dropped and the notes would come out
+			// wrong: the tune falls silent until the next one
+			atomic_store(&audio_error, p->error);
+			continue;
 		}
-		if (obtainedAudioSpec.channels == 2) {
-			numbytes_chunk <<= 1;
+
+		if (obtainedAudioSpec.format == AUDIO_F32LSB) {
+			s16tofloat(p->fmopl_output_buffer, p->float_buffer, numsamples_chunk);
 		}
+		numbytes_chunk = numsamples_chunk * bytes_per_sample;
 								
-		audio_callback_inner(stream, numsamples_chunk);
+		audio_callback_inner(p, stream, numsamples_chunk);
 		stream += numbytes_chunk;
 								
 		numsamples_requested -= numsamples_chunk;							
@@ -770,34 +2537,38 @@ void audio_callback (void* userdata, Uint8* stream, int numbytes) {
 }
 
 
-void audio_callback_float (void *stream, int numsamples) {
-	float *psrc = float_buffer;
+void audio_callback_float (PisPlayer *p, void *stream, int numsamples) {
+	float *psrc = p->float_buffer;
 	float *pdest = stream;
 	while (numsamples--) {
-		*pdest = *psrc;
+		*pdest = *psrc * audio_gain;
 		if (obtainedAudioSpec.channels == 2) {
 			pdest++;
-			*pdest = *psrc;
+			*pdest = *psrc * audio_gain;
 		}
 		psrc++;  pdest++;
 	}
 }
 
 
-void audio_callback_s16 (void *stream, int numsamples) {
-	INT16 *psrc = fmopl_output_buffer;
+void audio_callback_s16 (PisPlayer *p, void *stream, int numsamples) {
+	INT16 *psrc = p->fmopl_output_buffer;
 	INT16 *pdest = stream;
 	while (numsamples--) {
-		*pdest = *psrc;
+		float sample = *psrc * audio_gain;
+		*pdest = sample > 32767 ? 32767 : sample < -32768 ? -32768 : (INT16)sample;
 		if (obtainedAudioSpec.channels == 2) {
 			pdest++;
-			*pdest = *psrc;
+			*pdest = pdest[-1];
 		}
 		psrc++;  pdest++;
 	}
 }
 
 
+#endif
+
+
 void s16tofloat(INT16 *source, float *destination, int numsamples) {
 	INT16 samplev_i;
 	double samplev_f;
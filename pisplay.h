@@ -1,10 +1,23 @@
 #ifndef __PISPLAY_H
 #define __PISPLAY_H
 
+#include <stdio.h>
+#include <stddef.h>
 #include <stdint.h>
+#include <stdatomic.h>
+
+#include "fmopl.h"
 
 #define PIS_NONE -1
 
+// Module loading and seeking results
+#define PIS_OK 0
+#define PIS_ERROR_FILE -1 // cannot open or read the file
+#define PIS_ERROR_TRUNCATED -2 // shorter than its counts require
+#define PIS_ERROR_RANGE -3 // count, map or order entry out of range
+#define PIS_ERROR_MEMORY -4
+#define PIS_ERROR_NOT_REACHED -5 // seek target the tune never plays
+
 #define OPL_MAGIC 3579545
 #define OPL_NOTE_FREQUENCY_LO_B 0x143
 #define OPL_NOTE_FREQUENCY_LO_C 0x157
@@ -13,10 +26,26 @@
 
 #define FMOPL_OUTPUT_BUFFER_SIZE 32768
 #define PIS_DEFAULT_SPEED 6
+#define PIS_SIMULATE_MAX_FRAMES (50 * 60 * 60) // one hour
+#define PIS_END_TAIL_FRAMES 100 // ring-out after F00
+#define PIS_SEEK_INTERVAL_ROWS 16 // rows between seek checkpoints
+#define PIS_ROW_MAX_OPS 8 // room for the longest op run of compile_row
 
 
-#define readb(f) ((uint8_t)fgetc(f))
-#define replay_reset_voice(v) replay_set_voice_volatiles(v, 0, 0, 0);
+#define PIS_PATTERN_BYTES (64 * 3) // 64 packed rows
+#define PIS_INSTRUMENT_BYTES 11
+#define PIS_PACK_MAGIC "PISPACK" // with its NUL, 8 bytes
+#define PIS_PACK_VERSION 2
+#define PIS_PACK_NAME_SIZE 32
+#define PIS_CACHE_MAGIC "PISC\0\0\0" // with its NUL, 8 bytes
+#define PIS_CACHE_VERSION 1 // layout of the .pisc file
+#define PIS_REPLAY_REVISION 1 // bump when replay output or state changes
+#define PIS_CACHE_ALIGN 8 // of every .pisc section
+#define PIS_PATH_MAX 1024
+#define PIS_QUEUE_SIZE 16 // commands in flight, a power of two
+#define PIS_DEVICE_SAMPLES 16384 // device buffer when rendering in the callback
+#define PIS_WORKER_DEVICE_SAMPLES 2048 // device buffer fed from the render worker
+#define replay_reset_voice(p, v) replay_set_voice_volatiles(p, v, 0, 0, 0);
 #define EFFECT_HI(r) ((r)->effect >> 8)
 #define EFFECT_LO(r) ((r)->effect & 0xff)
 #define EFFECT_MIDNIB(r) (((r)->effect >> 4) & 15)
@@ -36,24 +65,34 @@ typedef struct {
 } PisInstrument;
 
 
+typedef struct {
+	uint16_t effect;
+	uint8_t note;
+	uint8_t octave;
+	uint8_t instrument;
+} PisRowUnpacked;
+
+
+// Sized to the tune: order, patterns and instruments share one arena
+// block. Order entries are indexes into pattern[], resolved at load.
 typedef struct {
 	uint8_t length; // length of order list
 	uint8_t number_of_patterns; // # of patterns stored in module
 	uint8_t number_of_instruments; // # of instruments stored in module
-	uint8_t pattern_map[128]; // maps physical to logical pattern
-	uint8_t instrument_map[32]; // maps physical to logical instrument
-	uint8_t order[256][9]; // order list for each channel
-	uint32_t pattern[128][64]; // pattern data
-	PisInstrument instrument[64]; // instrument data
+	uint8_t instrument_slot[32]; // maps logical instrument to instrument[]
+	uint8_t (*order)[9]; // order list for each channel, length + 1 entries
+	PisRowUnpacked (*pattern)[64]; // pattern data, unpacked at load
+	PisInstrument *instrument; // instrument data
+	void *arena;
+	size_t arena_size;
+	int borrowed; // arena lives in a mapped .pisc, not freed here
 } PisModule;
 
 
-typedef struct {
-	int note;
-	int octave;
-	int instrument;
-	int effect;
-} PisRowUnpacked;
+// The spare entry after the last order position, pattern and instrument
+// stands in for everything the file leaves out
+#define PIS_ORDER(m, position) ((m)->order[ (unsigned)(position) < (m)->length ? (position) : (m)->length ])
+#define PIS_INSTRUMENT(m, index) (&(m)->instrument[ (m)->instrument_slot[ (index) & 31 ] ])
 
 
 typedef struct {
@@ -92,51 +131,365 @@ typedef struct {
 } PisReplayState;
 
 
-// Player control
-void pisplay_init();
+typedef struct {
+	long frame; // first frame of the checkpoint's row
+	PisReplayState replay_state;
+	int is_playing;
+	uint8_t opl_regs[256];
+} PisCheckpoint;
+
+
+typedef struct PisSeekIndex PisSeekIndex;
+
+
+// Ops of the row compiler, see pisplay_compile. Operand a is an
+// instrument or note, b an octave, gain, increment or whole effect.
+enum {
+	PIS_OP_END,
+	PIS_OP_PORTA_INSTRUMENT, // set instrument a, restore its level
+	PIS_OP_PORTA_TARGET, // portamento towards note a, octave b
+	PIS_OP_NOTE_OFF, // forget the previous effect, key off
+	PIS_OP_INSTRUMENT, // set instrument a if new, else restore its level
+	PIS_OP_NEW_INSTRUMENT, // set instrument a if new
+	PIS_OP_LEVEL, // level of instrument a from Cxx gain b
+	PIS_OP_SWITCH_INSTRUMENT, // instrument only row, Cxx gain b or PIS_NONE
+	PIS_OP_FORGET_EFFECT,
+	PIS_OP_VOICE_LEVEL, // level of the voice's instrument from Cxx gain b
+	PIS_OP_RESTORE_LEVEL, // restore the level of the voice's instrument
+	PIS_OP_NOTE, // trigger note a, octave b
+	PIS_OP_END_ARPEGGIO, // back to the base tone after an arpeggio
+	PIS_OP_ARPEGGIO, // arm the arpeggio of effect b
+	PIS_OP_ARPEGGIO_OFF,
+	PIS_OP_SLIDE, // slide by b per frame
+	PIS_OP_PORTA, // portamento by b per frame
+	PIS_OP_POSITION_JUMP, // effect b
+	PIS_OP_PATTERN_BREAK, // effect b
+	PIS_OP_LOOP, // effect b
+	PIS_OP_VOLUME_SLIDE, // effect b
+	PIS_OP_SPEED, // effect b
+	PIS_OP_EFFECT, // remember effect b for the next row
+	PIS_OP_NO_EFFECT // forget the previous effect, reset the voice
+};
+
+
+typedef struct {
+	uint8_t op;
+	uint8_t a;
+	int16_t b;
+} PisOp;
+
+
+typedef struct {
+	uint32_t (*start)[64]; // first op of each pattern row
+	PisOp *op;
+	int numops;
+} PisProgram;
+
+
+// Tune pack: this header, count index entries and the modules back to
+// back, little-endian, then each tune's .pisc image. Built by pisrender
+// --pack, used in place through pisplay_open_pack.
+typedef struct {
+	char magic[8];
+	uint32_t version;
+	uint32_t count;
+} PisPackHeader;
+
+
+typedef struct {
+	char name[PIS_PACK_NAME_SIZE]; // file name of the module, NUL padded
+	uint32_t offset; // from the start of the pack
+	uint32_t size;
+	uint32_t duration_frames; // play time as pisplay_load_and_play returns it
+	uint32_t cache_offset; // .pisc image of the module, PIS_CACHE_ALIGN aligned
+	uint32_t cache_size; // 0 without one
+	uint32_t reserved;
+	uint64_t hash; // pisplay_hash of the module
+} PisPackEntry;
+
+
+typedef struct {
+	const uint8_t *data;
+	size_t size;
+	const PisPackEntry *entry;
+	int count;
+	int mapped; // data is mmap'd, else read into memory
+} PisPack;
+
+
+// Levels of a tune over its play time, for the .pisc
+typedef struct {
+	float peak; // largest sample magnitude, 1 is full scale
+	float loudness; // RMS in dBFS
+	int32_t rate; // rendered at
+	int32_t reserved;
+} PisLevels;
+
+
+//
+// .pisc: what loading and seeking a .PIS would compute, ready to be used
+// in place from a mapping. The header is followed by the sections it
+// points to: the module arena, the checkpoints and, for each order
+// position up to first_entry_positions, the frame each row is first
+// reached or PIS_NONE. Host layout, rejected unless versions, revisions
+// and checkpoint size all match.
+//
+typedef struct {
+	char magic[8];
+	uint32_t version;
+	uint32_t emulator_revision; // FMOPL_REVISION of the levels
+	uint32_t replay_revision; // PIS_REPLAY_REVISION of the checkpoints
+	uint32_t checkpoint_size; // sizeof(PisCheckpoint)
+	uint64_t source_hash; // pisplay_hash of the .PIS
+	uint64_t source_size;
+	int32_t length_frames; // the PisSongInfo
+	int32_t ends;
+	int32_t loops;
+	int32_t loop_position;
+	int32_t loop_row;
+	int32_t loop_start_frame;
+	int32_t loop_frames;
+	int32_t rows;
+	PisLevels levels;
+	uint8_t length; // the PisModule
+	uint8_t number_of_patterns;
+	uint8_t number_of_instruments;
+	uint8_t reserved;
+	uint8_t instrument_slot[32];
+	uint32_t module_offset;
+	uint32_t module_size;
+	int32_t interval_rows; // the PisSeekIndex
+	int32_t numcheckpoints;
+	uint32_t checkpoint_offset;
+	uint32_t first_entry_offset; // int32_t [first_entry_positions][64]
+	int32_t first_entry_positions;
+} PisCacheHeader;
+
+
+typedef struct {
+	const uint8_t *data;
+	size_t size;
+	int mapped;
+	int borrowed; // data lives in a tune pack, not unmapped here
+	const PisCacheHeader *header;
+} PisCache;
+
+
+// Everything that changes while a loaded tune plays
+typedef struct {
+	PisReplayState replay_state;
+	int is_playing;
+	UINT32 frame_time;
+	long frame;
+	uint8_t opl_regs[256];
+	OPL_STATE opl;
+} PisPlayerState;
+
+
+typedef struct {
+	PisModule module;
+	PisReplayState replay_state;
+	int is_playing;
+	FM_OPL *opl;
+	INT16 *fmopl_output_buffer;
+	float *float_buffer;
+	int samples_per_frame;
+	UINT32 frame_time; // sample clock of the next replay frame
+	int simulate; // drop OPL writes, see pisplay_simulate
+	long frame; // replay frames run since start or the last seek
+	uint8_t opl_regs[256]; // last value written to each OPL register
+	PisSeekIndex *seek_index; // built by the first seek
+	PisProgram *program; // compiled rows, NULL runs the interpreter
+	PisCache *cache; // .pisc the module and seek index come from, or NULL
+	int error; // PIS_ERROR_MEMORY once an OPL write could not be queued
+} PisPlayer;
+
+
+// Commands to the audio side
+enum {
+	PIS_COMMAND_PLAY, // switch to player, retire the current one
+	PIS_COMMAND_STOP, // retire the current player, play silence
+	PIS_COMMAND_PAUSE, // value nonzero pauses, zero resumes
+	PIS_COMMAND_SEEK, // to frame, if the player has its seek index
+	PIS_COMMAND_GAIN // output gain value
+};
+
+
+typedef struct {
+	int type;
+	PisPlayer *player;
+	long frame;
+	float value;
+} PisCommand;
+
+
+// Single-producer single-consumer ring: head is only written by the
+// consumer, tail by the producer, each store releases what it passes on
+typedef struct {
+	PisCommand command[PIS_QUEUE_SIZE];
+	atomic_uint head; // next to pop
+	atomic_uint tail; // next to push
+} PisQueue;
+
+
+// Single-producer single-consumer byte ring, same rules as PisQueue
+typedef struct {
+	uint8_t *data;
+	unsigned size; // a power of two
+	atomic_uint read; // total bytes read
+	atomic_uint write; // total bytes written
+} PisRing;
+
+
+typedef struct {
+	long length_frames; // frames until the tune stops or starts to repeat
+	int ends; // stopped on F00
+	int loops; // repeats forever from the loop point
+	int loop_position; // order position of the loop point
+	int loop_row; // row of the loop point
+	long loop_start_frame; // frame the loop point is first reached
+	long loop_frames; // frames per repetition
+	long rows; // rows simulated
+} PisSongInfo;
+
+
+struct PisSeekIndex {
+	PisSongInfo info;
+	int interval_rows;
+	PisCheckpoint *checkpoint; // ascending frames
+	int numcheckpoints;
+	int borrowed; // checkpoints live in a mapped .pisc, not freed here
+	long first_entry[256][64]; // frame a position/row is first reached, or PIS_NONE
+};
+
+
+// Player objects, independent of SDL and of each other
+PisPlayer *pisplay_create(int rate);
+void pisplay_destroy(PisPlayer *p);
+int pisplay_start(PisPlayer *p, const char *path);
+int pisplay_load_from_memory(PisPlayer *p, const void *data, size_t size);
+const char *pisplay_error_string(int error);
+PisPack *pisplay_open_pack(const char *path);
+void pisplay_close_pack(PisPack *pack);
+int pisplay_pack_find(const PisPack *pack, const char *name);
+int pisplay_start_packed(PisPlayer *p, const PisPack *pack, int index);
+uint64_t pisplay_hash(const void *data, size_t size);
+PisCache *pisplay_open_cache(const char *path);
+PisCache *pisplay_open_packed_cache(const PisPack *pack, int index);
+void pisplay_close_cache(PisCache *cache);
+int pisplay_cache_is_fresh(const PisCache *cache, const void *source, size_t size);
+int pisplay_start_cache(PisPlayer *p, PisCache *cache);
+int pisplay_write_cache(PisPlayer *p, const char *path, const void *source, size_t size, const PisLevels *levels);
+int pisplay_write_cache_image(PisPlayer *p, FILE *f, const void *source, size_t size, const PisLevels *levels);
+const PisLevels *pisplay_levels(const PisPlayer *p);
+void pisplay_cache_path(char *destination, size_t size, const char *path);
+void pisplay_free_seek_index(PisPlayer *p);
+int pisplay_render(PisPlayer *p, INT16 *buffer, int numsamples);
+int pisplay_simulate(PisPlayer *p, PisSongInfo *info, long max_frames);
+uint64_t replay_flow_key(PisReplayState *s);
+int pisplay_build_seek_index(PisPlayer *p, int interval_rows);
+int pisplay_seek_frame(PisPlayer *p, long frame);
+int pisplay_seek_time(PisPlayer *p, double seconds);
+int pisplay_seek_position(PisPlayer *p, int position, int row);
+void pisplay_save_state(PisPlayer *p, PisPlayerState *state);
+int pisplay_load_state(PisPlayer *p, const PisPlayerState *state);
+int pisplay_compile(PisPlayer *p);
+void pisplay_free_program(PisPlayer *p);
+int pisplay_queue_push(PisQueue *q, const PisCommand *command);
+int pisplay_queue_pop(PisQueue *q, PisCommand *command);
+int pisplay_ring_init(PisRing *ring, unsigned min_size);
+void pisplay_ring_free(PisRing *ring);
+unsigned pisplay_ring_fill(PisRing *ring);
+unsigned pisplay_ring_write(PisRing *ring, const void *data, unsigned size);
+unsigned pisplay_ring_read(PisRing *ring, void *data, unsigned size);
+
+#ifndef PISPLAY_NO_SDL
+// Player control (SDL audio device), from one thread
+void pisplay_init(int render_ahead_samples);
 void pisplay_shutdown();
-void pisplay_load_and_play(const char *path);
-void load_module(const char *path, PisModule *module);
-void load_pattern(uint32_t *destination, FILE *f);
-void load_instrument(PisInstrument *pinstr, FILE *f);
+long pisplay_load_and_play(const char *path);
+long pisplay_load_and_play_packed(const PisPack *pack, int index);
+int pisplay_stop();
+int pisplay_pause(int paused);
+int pisplay_seek(long frame);
+int pisplay_set_gain(float gain);
+int pisplay_audio_error();
+#endif
+
+// Module loading
+int load_module(const char *path, PisModule *module);
+int read_file(const char *path, uint8_t **data, size_t *size);
+int map_file(const char *path, const uint8_t **data, size_t *size);
+void unmap_file(const uint8_t *data, size_t size, int mapped);
+int load_module_from_memory(PisModule *module, const void *data, size_t size);
+void start_module(PisPlayer *p, PisModule *module);
+void alloc_module(PisModule *module, int length, int number_of_patterns, int number_of_instruments);
+size_t module_arena_size(int length, int number_of_patterns, int number_of_instruments);
+void layout_module(PisModule *module, void *arena, int length, int number_of_patterns, int number_of_instruments);
+void copy_module(PisModule *destination, const PisModule *source);
+void free_module(PisModule *module);
+void load_pattern(PisRowUnpacked *destination, const uint8_t *source);
+void load_instrument(PisInstrument *pinstr, const uint8_t *source);
+uint32_t cache_align(size_t offset);
+int write_cache_section(FILE *f, long base, uint32_t offset, const void *data, size_t size);
+int cache_section_fits(const PisCache *cache, uint32_t offset, size_t size);
+int check_cache(PisCache *cache);
+int check_cached_module(const PisModule *module);
+int check_cached_row(const PisRowUnpacked *r);
+int check_cached_checkpoint(const PisCheckpoint *c, long length_frames);
+int check_cached_seek_index(const PisCache *cache);
 
 // Replay routine
-void init_replay_state(PisReplayState *pstate);
-void replay_frame_routine();
-void replay_voice(int);
-void unpack_row();
-void advance_row();
-void replay_enter_row_with_portamento(int v, PisVoiceState *vs, PisRowUnpacked *r);
-void replay_enter_row_with_instrument_and_note(int v, PisVoiceState *vs, PisRowUnpacked *r);
-void replay_enter_row_with_instrument_only(int v, PisVoiceState *vs, PisRowUnpacked *r);
-void replay_enter_row_with_note_only(int v, PisVoiceState *vs, PisRowUnpacked *r);				
-void replay_enter_row_with_possibly_effect_only(int v, PisVoiceState *vs, PisRowUnpacked *r);
-void replay_handle_effect(int v, PisVoiceState *vs, PisRowUnpacked *r);
-void replay_handle_arpeggio(int v, PisVoiceState *vs, PisRowUnpacked *r);
-void replay_handle_posjmp(int v, PisRowUnpacked *r);
-void replay_handle_ptnbreak(int v, PisRowUnpacked *r);
-void replay_handle_speed(int v, PisRowUnpacked *r);
-void replay_handle_exx_command(int v, PisVoiceState *vs, PisRowUnpacked *r);
-void replay_handle_loop(int v, PisRowUnpacked *r);
-void replay_handle_volume_slide(int v, PisVoiceState *vs, PisRowUnpacked *r);
-void replay_do_per_frame_effects();
-void replay_do_per_frame_portamento(int v, PisVoiceState *vs);
-void replay_set_note(int v, PisVoiceState *vs, PisRowUnpacked *r);
-void replay_set_instrument(int v, int instr_index);
-void replay_set_level(int v, int instr_index, int gain, int do_apply_correction);
-void replay_set_voice_volatiles(int v, int arpeggio_flag, int slide_increment, int porta_increment);
+void init_replay_state(PisPlayer *p);
+void replay_frame_routine(PisPlayer *p);
+void replay_voice(PisPlayer *p, int);
+void replay_voice_compiled(PisPlayer *p, int v, int pattern, int row);
+int compile_row(PisOp *op, const PisRowUnpacked *r);
+PisOp *emit_op(PisOp *o, int op, int a, int b);
+void unpack_row(PisPlayer *p);
+void advance_row(PisPlayer *p);
+void replay_enter_row_with_portamento(PisPlayer *p, int v, PisVoiceState *vs, PisRowUnpacked *r);
+void replay_enter_row_with_instrument_and_note(PisPlayer *p, int v, PisVoiceState *vs, PisRowUnpacked *r);
+void replay_enter_row_with_instrument_only(PisPlayer *p, int v, PisVoiceState *vs, PisRowUnpacked *r);
+void replay_enter_row_with_note_only(PisPlayer *p, int v, PisVoiceState *vs, PisRowUnpacked *r);				
+void replay_enter_row_with_possibly_effect_only(PisPlayer *p, int v, PisVoiceState *vs, PisRowUnpacked *r);
+void replay_handle_effect(PisPlayer *p, int v, PisVoiceState *vs, PisRowUnpacked *r);
+void replay_handle_arpeggio(PisPlayer *p, int v, PisVoiceState *vs, PisRowUnpacked *r);
+void replay_handle_posjmp(PisPlayer *p, int v, PisRowUnpacked *r);
+void replay_handle_ptnbreak(PisPlayer *p, int v, PisRowUnpacked *r);
+void replay_handle_speed(PisPlayer *p, int v, PisRowUnpacked *r);
+void replay_handle_exx_command(PisPlayer *p, int v, PisVoiceState *vs, PisRowUnpacked *r);
+void replay_handle_loop(PisPlayer *p, int v, PisRowUnpacked *r);
+void replay_handle_volume_slide(PisPlayer *p, int v, PisVoiceState *vs, PisRowUnpacked *r);
+void replay_do_per_frame_effects(PisPlayer *p);
+void replay_do_per_frame_portamento(PisPlayer *p, int v, PisVoiceState *vs);
+void replay_set_note(PisPlayer *p, int v, PisVoiceState *vs, PisRowUnpacked *r);
+void replay_set_instrument(PisPlayer *p, int v, int instr_index);
+void replay_set_level(PisPlayer *p, int v, int instr_index, int gain, int do_apply_correction);
+void replay_set_voice_volatiles(PisPlayer *p, int v, int arpeggio_flag, int slide_increment, int porta_increment);
 
 // Audio, OPL
+#ifndef PISPLAY_NO_SDL
 void audio_callback (void* userdata, Uint8* stream, int numbytes);
-void audio_callback_float (void*, int);
-void audio_callback_s16 (void*, int);
-void s16tofloat(int16_t *source, float *destination, int numsamples);
-void init_audio();
+void audio_callback_float (PisPlayer*, void*, int);
+void audio_callback_s16 (PisPlayer*, void*, int);
+void init_audio(int samples);
 void init_opl();
-void oplout(int r, int v);
-void opl_set_pitch(int v, int freq, int octave);
-void opl_set_instrument(int v, PisInstrument *instr);
-void opl_note_off(int v);
+int audio_bytes_per_sample();
+int start_render_worker(int render_ahead_samples);
+int render_worker_fn(void *data);
+void render_audio(Uint8 *stream, int numbytes);
+long play_player(PisPlayer *p, long duration_frames);
+PisPlayer *take_spare_player();
+int send_audio_command(int type, PisPlayer *player, long frame, float value);
+void run_audio_commands();
+#endif
+void s16tofloat(int16_t *source, float *destination, int numsamples);
+void oplout(PisPlayer *p, int r, int v);
+void opl_load_registers(PisPlayer *p);
+void opl_set_pitch(PisPlayer *p, int v, int freq, int octave);
+void opl_set_instrument(PisPlayer *p, int v, PisInstrument *instr);
+void opl_note_off(PisPlayer *p, int v);
 
 
 #endif
@@ -0,0 +1,1399 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+#include <strings.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <pthread.h>
+
+#include "fmopl.h"
+#include "pisplay.h"
+
+
+#define RENDER_DEFAULT_RATE 44100
+#define RENDER_BLOCK_SAMPLES 8192
+#define RENDER_MAX_CHANNELS 8
+#define RENDER_MAX_THREADS 256
+#define RENDER_SEGMENTS_PER_THREAD 4
+#define RENDER_SEGMENT_MIN_SAMPLES (16 * RENDER_BLOCK_SAMPLES)
+#define RENDER_BENCH_SECONDS 0.25
+#define RENDER_SILENCE_DBFS -120.0 // loudness of a tune that never sounds
+
+#define WAVE_FORMAT_PCM 0x0001
+#define WAVE_FORMAT_IEEE_FLOAT 0x0003
+#define WAVE_FORMAT_EXTENSIBLE 0xfffe
+#define WAVE_MAX_DATA_BYTES (0xffffffffu - 4 - 8 - 40 - 8) // RIFF size of the largest header
+
+
+typedef enum {
+	FORMAT_U8,
+	FORMAT_S16,
+	FORMAT_S24,
+	FORMAT_S32,
+	FORMAT_F32
+} RenderFormat;
+
+
+typedef struct {
+	const char *name;
+	RenderFormat format;
+	int bytes;
+	int is_float;
+} RenderFormatInfo;
+
+
+const RenderFormatInfo render_formats[] = {
+	{ "u8",  FORMAT_U8,  1, 0 },
+	{ "s16", FORMAT_S16, 2, 0 },
+	{ "s24", FORMAT_S24, 3, 0 },
+	{ "s32", FORMAT_S32, 4, 0 },
+	{ "f32", FORMAT_F32, 4, 1 },
+};
+
+
+typedef struct {
+	const char *tune_path;
+	const char *output_path;
+	const char *output_dir; // batch mode when set
+	char **inputs;
+	int numinputs;
+	int threads;
+	int rate;
+	int channels;
+	const RenderFormatInfo *format;
+	long max_frames; // 0: the simulated play time
+	double start_seconds; // seek before rendering
+	int start_position; // PIS_NONE or the order position to start at
+	int start_row;
+	int raw;
+	int info;
+	int bench;
+	int compile; // replay through the row compiler
+	int verify;
+	const char *pack_path; // write a tune pack
+	int cache; // write a .pisc next to each tune
+} RenderOptions;
+
+
+typedef struct {
+	char *tune_path;
+	char *output_path;
+	long samples;
+	double seconds; // wall time spent rendering
+	int failed;
+} RenderTask;
+
+
+//
+// Work-stealing pool: every worker owns a deque of task indices, pops
+// from its own bottom and steals from the top of the others when empty
+//
+typedef struct {
+	pthread_mutex_t lock;
+	int *task;
+	int top, bottom;
+} RenderDeque;
+
+
+typedef struct {
+	RenderOptions *opt;
+	RenderTask *tasks;
+	RenderDeque *deques;
+	int numworkers;
+	pthread_mutex_t report_lock;
+} RenderPool;
+
+
+typedef struct {
+	RenderPool *pool;
+	int index;
+} RenderWorker;
+
+
+//
+// Segments of one tune: a synthesis-free pass saves the player state at
+// every segment start, workers render the segments from those states as
+// they come in, each straight into its part of the output file
+//
+typedef struct {
+	RenderOptions *opt;
+	PisPlayer *master;
+	PisPlayerState *state; // at the start of each segment
+	long segment_samples;
+	long total_samples;
+	int numsegments;
+	int ready; // states saved so far
+	int next; // next segment to hand out
+	int failed;
+	int fd;
+	off_t data_offset;
+	pthread_mutex_t lock;
+	pthread_cond_t state_saved;
+} RenderSegments;
+
+
+void usage(const char *argv0);
+int parse_options(int argc, char **argv, RenderOptions *opt);
+double now_seconds();
+int render_tune(RenderOptions *opt, const char *tune_path, const char *output_path, long *rendered);
+int render_batch(RenderOptions *opt);
+int render_segments(RenderOptions *opt, PisPlayer *player, FILE *out, const char *output_path, long total_samples);
+void *segment_worker(void *arg);
+int print_info(RenderOptions *opt);
+int bench_rows(RenderOptions *opt);
+int verify_compile(RenderOptions *opt);
+double bench_replay(PisPlayer *player, PisSongInfo *info, long *rows);
+int write_pack(RenderOptions *opt);
+int write_caches(RenderOptions *opt);
+int measure_levels(PisPlayer *player, PisLevels *levels);
+int collect_tasks(RenderOptions *opt, RenderTask **ptasks);
+int add_task(RenderOptions *opt, RenderTask **ptasks, int *numtasks, const char *tune_path);
+int compare_tasks(const void *a, const void *b);
+int deque_pop(RenderDeque *d);
+int deque_steal(RenderDeque *d);
+void *render_worker(void *arg);
+void put_le(uint8_t *p, uint32_t v, int bytes);
+void write_wav_header(FILE *f, RenderOptions *opt, uint32_t numframes);
+void convert_block(RenderOptions *opt, INT16 *source, uint8_t *destination, int numsamples);
+
+
+int main (int argc, char **argv) {
+	RenderOptions opt;
+	long rendered;
+
+	if (parse_options(argc, argv, &opt) != 0) {
+		usage(argv[0]);
+		return 2;
+	}
+
+	if (opt.info) {
+		return print_info(&opt);
+	}
+	if (opt.bench) {
+		return bench_rows(&opt);
+	}
+	if (opt.verify) {
+		return verify_compile(&opt);
+	}
+	if (opt.pack_path) {
+		return write_pack(&opt);
+	}
+	if (opt.cache) {
+		return write_caches(&opt);
+	}
+	if (opt.output_dir) {
+		return render_batch(&opt);
+	}
+
+	if (render_tune(&opt, opt.tune_path, opt.output_path, &rendered) != 0) {
+		return 1;
+	}
+	fprintf(stderr, "%s: %ld samples, %.1f s at %d Hz\n",
+		opt.tune_path, rendered, (double)rendered / opt.rate, opt.rate);
+	return 0;
+}
+
+
+double now_seconds() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
+int render_tune(RenderOptions *opt, const char *tune_path, const char *output_path, long *rendered) {
+	PisPlayer *player;
+	FILE *out = NULL;
+	INT16 *block = NULL;
+	uint8_t *converted = NULL;
+	long total_samples;
+	int frame_bytes, error, result = -1;
+	struct stat st;
+
+	*rendered = 0;
+
+	// Load first, a broken tune leaves no output file behind
+	player = pisplay_create(opt->rate);
+	if (!player) {
+		fprintf(stderr, "pisrender: out of memory\n");
+		return -1;
+	}
+	error = pisplay_start(player, tune_path);
+	if (error != PIS_OK) {
+		fprintf(stderr, "%s: %s\n", tune_path, pisplay_error_string(error));
+		pisplay_destroy(player);
+		return -1;
+	}
+
+	frame_bytes = opt->channels * opt->format->bytes;
+	block = malloc(RENDER_BLOCK_SAMPLES * sizeof(INT16));
+	converted = malloc(RENDER_BLOCK_SAMPLES * frame_bytes);
+	if (!block || !converted) {
+		fprintf(stderr, "pisrender: out of memory\n");
+		goto done;
+	}
+	if (opt->compile && pisplay_compile(player) != 0) {
+		fprintf(stderr, "pisrender: out of memory\n");
+		goto done;
+	}
+
+	if (opt->start_position != PIS_NONE) {
+		error = pisplay_seek_position(player, opt->start_position, opt->start_row);
+		if (error == PIS_ERROR_NOT_REACHED) {
+			fprintf(stderr, "%s: position %d row %d is never played\n",
+				tune_path, opt->start_position, opt->start_row);
+			goto done;
+		}
+	} else if (opt->start_seconds > 0) {
+		error = pisplay_seek_time(player, opt->start_seconds);
+	}
+	if (error != PIS_OK) {
+		fprintf(stderr, "%s: %s\n", tune_path, pisplay_error_string(error));
+		goto done;
+	}
+
+	if (opt->max_frames) {
+		total_samples = opt->max_frames * player->samples_per_frame;
+	} else {
+		PisSongInfo info;
+		long frames;
+		if (pisplay_simulate(player, &info, PIS_SIMULATE_MAX_FRAMES) != 0) {
+			fprintf(stderr, "pisrender: out of memory\n");
+			goto done;
+		}
+		frames = (info.ends ? info.length_frames + PIS_END_TAIL_FRAMES : info.length_frames)
+			   - player->frame;
+		total_samples = (frames > 0 ? frames : 0) * player->samples_per_frame;
+	}
+
+	// The WAV sizes are 32 bits, a longer render would wrap them
+	if (!opt->raw && (uint64_t)total_samples * frame_bytes > WAVE_MAX_DATA_BYTES) {
+		fprintf(stderr, "%s: %.1f s is over the 4 GiB WAV limit, use --raw\n",
+			tune_path, (double)total_samples / opt->rate);
+		goto done;
+	}
+
+	// Opened last, a tune that cannot be rendered leaves no output file
+	out = strcmp(output_path, "-") == 0
+		? stdout
+		: fopen(output_path, "wb");
+	if (!out) {
+		perror(output_path);
+		goto done;
+	}
+
+	//
+	// The header is written with the maximum length and patched once the
+	// real length is known; a pipe keeps the maximum
+	//
+	if (!opt->raw) {
+		write_wav_header(out, opt, total_samples);
+	}
+
+	//
+	// A long tune into a file is split over the threads; batch mode keeps
+	// them busy with whole tunes already
+	//
+	if (!opt->output_dir && opt->threads > 1 && total_samples >= 2 * RENDER_SEGMENT_MIN_SAMPLES
+		&& fstat(fileno(out), &st) == 0 && S_ISREG(st.st_mode)) {
+		if (render_segments(opt, player, out, output_path, total_samples) != 0) {
+			goto done;
+		}
+		*rendered = total_samples;
+	}
+
+	while (*rendered < total_samples) {
+		int numsamples = (total_samples - *rendered > RENDER_BLOCK_SAMPLES)
+					   ? RENDER_BLOCK_SAMPLES
+					   : total_samples - *rendered;
+
+		if (pisplay_render(player, block, numsamples) != 0) {
+			fprintf(stderr, "pisrender: out of memory\n");
+			goto done;
+		}
+		convert_block(opt, block, converted, numsamples);
+		if (fwrite(converted, frame_bytes, numsamples, out) != (size_t)numsamples) {
+			perror(output_path);
+			goto done;
+		}
+		*rendered += numsamples;
+	}
+
+	if (!opt->raw && *rendered != total_samples && fseek(out, 0, SEEK_SET) == 0) {
+		write_wav_header(out, opt, *rendered);
+	}
+	result = 0;
+
+done:
+	if (out && out != stdout && fclose(out) != 0 && result == 0) {
+		perror(output_path);
+		result = -1;
+	}
+	free(converted);
+	free(block);
+	pisplay_destroy(player);
+	return result;
+}
+
+
+int render_segments(RenderOptions *opt, PisPlayer *player, FILE *out, const char *output_path, long total_samples) {
+	RenderSegments seg;
+	pthread_t threads[RENDER_MAX_THREADS];
+	int s, w, numworkers, started = 0;
+
+	memset(&seg, 0, sizeof(seg));
+	seg.opt = opt;
+	seg.master = player;
+	seg.total_samples = total_samples;
+	seg.numsegments = opt->threads * RENDER_SEGMENTS_PER_THREAD;
+	if (seg.numsegments > total_samples / RENDER_SEGMENT_MIN_SAMPLES) {
+		seg.numsegments = total_samples / RENDER_SEGMENT_MIN_SAMPLES;
+	}
+	seg.segment_samples = (total_samples + seg.numsegments - 1) / seg.numsegments;
+	seg.state = malloc(seg.numsegments * sizeof(PisPlayerState));
+	if (!seg.state) {
+		fprintf(stderr, "pisrender: out of memory\n");
+		return -1;
+	}
+	if (fflush(out) != 0) {
+		perror(output_path);
+		free(seg.state);
+		return -1;
+	}
+	seg.fd = fileno(out);
+	seg.data_offset = ftello(out);
+	pthread_mutex_init(&seg.lock, NULL);
+	pthread_cond_init(&seg.state_saved, NULL);
+
+	numworkers = opt->threads < seg.numsegments ? opt->threads : seg.numsegments;
+	for (w=0; w<numworkers; w++) {
+		if (pthread_create(&threads[started], NULL, segment_worker, &seg) == 0) {
+			started++;
+		}
+	}
+
+	//
+	// The skip pass runs the replay and the chip without producing
+	// output; the workers start on segment 0 right away
+	//
+	for (s=0; s<seg.numsegments; s++) {
+		pthread_mutex_lock(&seg.lock);
+		pisplay_save_state(player, &seg.state[s]);
+		seg.ready++;
+		pthread_cond_broadcast(&seg.state_saved);
+		pthread_mutex_unlock(&seg.lock);
+		if (s + 1 < seg.numsegments && pisplay_render(player, NULL, seg.segment_samples) != 0) {
+			pthread_mutex_lock(&seg.lock);
+			seg.failed = 1;
+			pthread_mutex_unlock(&seg.lock);
+		}
+	}
+
+	// Segments no thread could be started for are rendered here, every
+	// state is saved by now
+	if (started < numworkers) {
+		segment_worker(&seg);
+	}
+	for (w=0; w<started; w++) {
+		pthread_join(threads[w], NULL);
+	}
+	if (seg.failed) {
+		perror(output_path);
+	}
+	pthread_cond_destroy(&seg.state_saved);
+	pthread_mutex_destroy(&seg.lock);
+	free(seg.state);
+	return seg.failed ? -1 : 0;
+}
+
+
+void *segment_worker(void *arg) {
+	RenderSegments *seg = arg;
+	RenderOptions *opt = seg->opt;
+	int frame_bytes = opt->channels * opt->format->bytes;
+	PisPlayer *player = pisplay_create(opt->rate);
+	INT16 *block = malloc(RENDER_BLOCK_SAMPLES * sizeof(INT16));
+	uint8_t *converted = malloc(RENDER_BLOCK_SAMPLES * frame_bytes);
+	int s;
+
+	if (!player || !block || !converted) {
+		pthread_mutex_lock(&seg->lock);
+		seg->failed = 1;
+		pthread_mutex_unlock(&seg->lock);
+		goto done;
+	}
+	copy_module(&player->module, &seg->master->module);
+	if (!player->module.arena || (opt->compile && pisplay_compile(player) != 0)) {
+		pthread_mutex_lock(&seg->lock);
+		seg->failed = 1;
+		pthread_mutex_unlock(&seg->lock);
+		goto done;
+	}
+
+	for (;;) {
+		long start, end, pos;
+
+		pthread_mutex_lock(&seg->lock);
+		if (seg->failed || seg->next == seg->numsegments) {
+			pthread_mutex_unlock(&seg->lock);
+			break;
+		}
+		s = seg->next++;
+		while (seg->ready <= s) {
+			pthread_cond_wait(&seg->state_saved, &seg->lock);
+		}
+		pthread_mutex_unlock(&seg->lock);
+
+		pisplay_load_state(player, &seg->state[s]);
+		start = s * seg->segment_samples;
+		end = start + seg->segment_samples < seg->total_samples
+			? start + seg->segment_samples
+			: seg->total_samples;
+
+		for (pos = start; pos < end; pos += RENDER_BLOCK_SAMPLES) {
+			int numsamples = end - pos > RENDER_BLOCK_SAMPLES ? RENDER_BLOCK_SAMPLES : end - pos;
+			size_t bytes = (size_t)numsamples * frame_bytes;
+
+			if (pisplay_render(player, block, numsamples) != 0) {
+				pthread_mutex_lock(&seg->lock);
+				seg->failed = 1;
+				pthread_mutex_unlock(&seg->lock);
+				break;
+			}
+			convert_block(opt, block, converted, numsamples);
+			if (pwrite(seg->fd, converted, bytes, seg->data_offset + (off_t)pos * frame_bytes) != (ssize_t)bytes) {
+				pthread_mutex_lock(&seg->lock);
+				seg->failed = 1;
+				pthread_mutex_unlock(&seg->lock);
+				break;
+			}
+		}
+	}
+
+done:
+	free(converted);
+	free(block);
+	pisplay_destroy(player);
+	return NULL;
+}
+
+
+int render_batch(RenderOptions *opt) {
+	RenderPool pool;
+	RenderWorker workers[RENDER_MAX_THREADS];
+	pthread_t threads[RENDER_MAX_THREADS];
+	RenderTask *tasks = NULL;
+	int numtasks, i, w, started = 0, idle = 0, failed = 0;
+	long total_samples = 0;
+	double wall;
+
+	numtasks = collect_tasks(opt, &tasks);
+	if (numtasks < 0) {
+		return 1;
+	}
+	if (numtasks == 0) {
+		fprintf(stderr, "pisrender: no .PIS files given\n");
+		return 1;
+	}
+	if (mkdir(opt->output_dir, 0777) != 0 && errno != EEXIST) {
+		perror(opt->output_dir);
+		return 1;
+	}
+
+	pool.opt = opt;
+	pool.tasks = tasks;
+	pool.numworkers = opt->threads < numtasks ? opt->threads : numtasks;
+	pool.deques = calloc(pool.numworkers, sizeof(RenderDeque));
+	if (!pool.deques) {
+		fprintf(stderr, "pisrender: out of memory\n");
+		failed = 1;
+		goto free_tasks;
+	}
+	pthread_mutex_init(&pool.report_lock, NULL);
+
+	//
+	// Deal the tasks out round-robin; stealing evens out the uneven
+	// tune lengths
+	//
+	for (w=0; w<pool.numworkers; w++) {
+		pthread_mutex_init(&pool.deques[w].lock, NULL);
+		pool.deques[w].task = malloc(numtasks * sizeof(int));
+		if (!pool.deques[w].task) {
+			failed = 1;
+		}
+	}
+	if (failed) {
+		fprintf(stderr, "pisrender: out of memory\n");
+		goto free_pool;
+	}
+	for (i=0; i<numtasks; i++) {
+		RenderDeque *d = &pool.deques[ i % pool.numworkers ];
+		d->task[ d->bottom++ ] = i;
+	}
+
+	wall = now_seconds();
+	for (w=0; w<pool.numworkers; w++) {
+		workers[w].pool = &pool;
+		workers[w].index = w;
+		if (pthread_create(&threads[started], NULL, render_worker, &workers[w]) == 0) {
+			started++;
+		} else {
+			idle = w;
+		}
+	}
+	// A worker that could not start runs here; it steals from the others
+	if (started < pool.numworkers) {
+		render_worker(&workers[idle]);
+	}
+	for (w=0; w<started; w++) {
+		pthread_join(threads[w], NULL);
+	}
+	wall = now_seconds() - wall;
+
+	for (i=0; i<numtasks; i++) {
+		if (tasks[i].failed) {
+			failed++;
+		} else {
+			total_samples += tasks[i].samples;
+		}
+	}
+	fprintf(stderr, "%d files, %d failed, %d threads: %.1f s of audio in %.2f s wall, "
+		"%.1f Msamples/s, %.0fx realtime\n",
+		numtasks, failed, pool.numworkers,
+		(double)total_samples / opt->rate, wall,
+		total_samples / wall / 1e6,
+		(double)total_samples / opt->rate / wall);
+
+free_pool:
+	for (w=0; w<pool.numworkers; w++) {
+		pthread_mutex_destroy(&pool.deques[w].lock);
+		free(pool.deques[w].task);
+	}
+	pthread_mutex_destroy(&pool.report_lock);
+	free(pool.deques);
+free_tasks:
+	for (i=0; i<numtasks; i++) {
+		free(tasks[i].tune_path);
+		free(tasks[i].output_path);
+	}
+	free(tasks);
+	return failed ? 1 : 0;
+}
+
+
+int print_info(RenderOptions *opt) {
+	RenderTask *tasks = NULL;
+	PisPlayer *player;
+	PisSongInfo info;
+	int numtasks, i, failed = 0;
+	double start, elapsed;
+	long rows = 0;
+
+	numtasks = collect_tasks(opt, &tasks);
+	player = pisplay_create(opt->rate);
+	if (numtasks < 0 || !player) {
+		failed = 1;
+		goto done;
+	}
+
+	start = now_seconds();
+	for (i=0; i<numtasks; i++) {
+		int error = pisplay_start(player, tasks[i].tune_path);
+		if (error != PIS_OK) {
+			fprintf(stderr, "%s: %s\n", tasks[i].tune_path, pisplay_error_string(error));
+			failed = 1;
+			continue;
+		}
+		if (pisplay_simulate(player, &info, PIS_SIMULATE_MAX_FRAMES) != 0) {
+			fprintf(stderr, "pisrender: out of memory\n");
+			failed = 1;
+			goto done;
+		}
+		rows += info.rows;
+		if (info.loops) {
+			printf("%s: %ld frames (%.2f s), loops to position %d row %d, "
+				"loop start %.2f s, loop length %.2f s\n",
+				tasks[i].tune_path, info.length_frames, info.length_frames / 50.0,
+				info.loop_position, info.loop_row,
+				info.loop_start_frame / 50.0, info.loop_frames / 50.0);
+		} else if (info.ends) {
+			printf("%s: %ld frames (%.2f s), ends\n",
+				tasks[i].tune_path, info.length_frames, info.length_frames / 50.0);
+		} else {
+			printf("%s: longer than %ld frames\n", tasks[i].tune_path, info.length_frames);
+		}
+		if (pisplay_levels(player)) {
+			printf("%s: peak %.3f, loudness %.1f dBFS (cached)\n", tasks[i].tune_path,
+				pisplay_levels(player)->peak, pisplay_levels(player)->loudness);
+		}
+	}
+	elapsed = now_seconds() - start;
+	fprintf(stderr, "%ld rows simulated in %.3f s, %.2f Mrows/s (including loading)\n",
+		rows, elapsed, rows / elapsed / 1e6);
+
+done:
+	for (i=0; i<numtasks; i++) {
+		free(tasks[i].tune_path);
+		free(tasks[i].output_path);
+	}
+	pisplay_destroy(player);
+	free(tasks);
+	return failed;
+}
+
+//
+// Replay microbenchmark, each for RENDER_BENCH_SECONDS per tune: the
+// play time without synthesis over and over, interpreted and compiled,
+// and unpack_row alone over every row of the order list
+//
+int bench_rows(RenderOptions *opt) {
+	RenderTask *tasks = NULL;
+	PisPlayer *player;
+	PisSongInfo info;
+	int numtasks, i, failed = 0;
+	double replay_elapsed = 0, compiled_elapsed = 0, fetch_elapsed = 0;
+	long replay_rows = 0, compiled_rows = 0, fetch_rows = 0;
+
+	numtasks = collect_tasks(opt, &tasks);
+	player = pisplay_create(opt->rate);
+	if (numtasks < 0 || !player) {
+		failed = 1;
+		goto done;
+	}
+
+	for (i=0; i<numtasks; i++) {
+		PisReplayState *s = &player->replay_state;
+		double start, replay, compiled, fetch;
+		long rows = 0, crows = 0, fetched = 0;
+		int error = pisplay_start(player, tasks[i].tune_path);
+
+		if (error != PIS_OK) {
+			fprintf(stderr, "%s: %s\n", tasks[i].tune_path, pisplay_error_string(error));
+			failed = 1;
+			continue;
+		}
+		if (pisplay_simulate(player, &info, PIS_SIMULATE_MAX_FRAMES) != 0) {
+			fprintf(stderr, "pisrender: out of memory\n");
+			failed = 1;
+			goto done;
+		}
+
+		replay = bench_replay(player, &info, &rows);
+		if (pisplay_compile(player) != 0) {
+			fprintf(stderr, "pisrender: out of memory\n");
+			failed = 1;
+			goto done;
+		}
+		compiled = bench_replay(player, &info, &crows);
+		pisplay_free_program(player);
+
+		start = now_seconds();
+		do {
+			for (s->position=0; s->position<player->module.length; s->position++) {
+				for (s->row=0; s->row<64; s->row++) {
+					unpack_row(player);
+				}
+			}
+			fetched += player->module.length * 64;
+			fetch = now_seconds() - start;
+		} while (fetch < RENDER_BENCH_SECONDS);
+
+		printf("%s: replay %.2f Mrows/s, compiled %.2f Mrows/s, unpack_row %.1f Mrows/s\n",
+			tasks[i].tune_path, rows / replay / 1e6, crows / compiled / 1e6, fetched / fetch / 1e6);
+		replay_rows += rows;
+		replay_elapsed += replay;
+		compiled_rows += crows;
+		compiled_elapsed += compiled;
+		fetch_rows += fetched;
+		fetch_elapsed += fetch;
+	}
+	printf("%d files: replay %.2f Mrows/s, compiled %.2f Mrows/s, unpack_row %.1f Mrows/s\n", numtasks,
+		replay_rows / replay_elapsed / 1e6, compiled_rows / compiled_elapsed / 1e6,
+		fetch_rows / fetch_elapsed / 1e6);
+
+done:
+	for (i=0; i<numtasks; i++) {
+		free(tasks[i].tune_path);
+		free(tasks[i].output_path);
+	}
+	pisplay_destroy(player);
+	free(tasks);
+	return failed;
+}
+
+
+// The play time without synthesis, repeated for RENDER_BENCH_SECONDS
+double bench_replay(PisPlayer *player, PisSongInfo *info, long *rows) {
+	double start = now_seconds(), elapsed;
+	long frame;
+
+	player->simulate = 1;
+	do {
+		init_replay_state(player);
+		player->is_playing = 1;
+		for (frame=0; frame<info->length_frames && player->is_playing; frame++) {
+			replay_frame_routine(player);
+		}
+		*rows += info->rows;
+		elapsed = now_seconds() - start;
+	} while (elapsed < RENDER_BENCH_SECONDS);
+	player->simulate = 0;
+	return elapsed;
+}
+
+
+//
+// Runs every tune with the interpreter and the row compiler side by
+// side over its play time. Each frame's writes wait in the OPL queue,
+// both queues must hold the same writes in the same order; they are
+// then applied without rendering.
+//
+int verify_compile(RenderOptions *opt) {
+	RenderTask *tasks = NULL;
+	PisPlayer *a, *b;
+	PisSongInfo info;
+	int numtasks, i, failed = 0;
+
+	numtasks = collect_tasks(opt, &tasks);
+	a = pisplay_create(opt->rate);
+	b = pisplay_create(opt->rate);
+	if (numtasks < 0 || !a || !b) {
+		failed = 1;
+		goto done;
+	}
+
+	for (i=0; i<numtasks; i++) {
+		long frame, frames, writes = 0;
+		int same = 1;
+		int error = pisplay_start(a, tasks[i].tune_path);
+
+		if (error == PIS_OK) {
+			error = pisplay_start(b, tasks[i].tune_path);
+		}
+		if (error != PIS_OK) {
+			fprintf(stderr, "%s: %s\n", tasks[i].tune_path, pisplay_error_string(error));
+			failed = 1;
+			continue;
+		}
+		if (pisplay_simulate(a, &info, PIS_SIMULATE_MAX_FRAMES) != 0 || pisplay_compile(b) != 0) {
+			fprintf(stderr, "pisrender: out of memory\n");
+			failed = 1;
+			goto done;
+		}
+		frames = info.ends ? info.length_frames + PIS_END_TAIL_FRAMES : info.length_frames;
+
+		for (frame=0; frame<frames && same; frame++) {
+			int n, k;
+
+			replay_frame_routine(a);
+			replay_frame_routine(b);
+			n = a->opl->queue_tail - a->opl->queue_head;
+			same = n == b->opl->queue_tail - b->opl->queue_head
+				&& a->is_playing == b->is_playing
+				&& memcmp(&a->replay_state, &b->replay_state, offsetof(PisReplayState, row_buffer)) == 0;
+			for (k=0; k<n && same; k++) {
+				OPL_EVENT *ea = &a->opl->queue[ a->opl->queue_head + k ];
+				OPL_EVENT *eb = &b->opl->queue[ b->opl->queue_head + k ];
+				same = ea->time == eb->time && ea->r == eb->r && ea->v == eb->v;
+			}
+			writes += n;
+			YM3812UpdateQueued(a->opl, NULL, 0);
+			YM3812UpdateQueued(b->opl, NULL, 0);
+		}
+
+		if (same) {
+			printf("%s: %ld frames, %ld writes, same\n", tasks[i].tune_path, frames, writes);
+		} else {
+			printf("%s: differs in frame %ld\n", tasks[i].tune_path, frame - 1);
+			failed = 1;
+		}
+	}
+
+done:
+	for (i=0; i<numtasks; i++) {
+		free(tasks[i].tune_path);
+		free(tasks[i].output_path);
+	}
+	pisplay_destroy(a);
+	pisplay_destroy(b);
+	free(tasks);
+	return failed;
+}
+
+
+
+void *render_worker(void *arg) {
+	RenderWorker *worker = arg;
+	RenderPool *pool = worker->pool;
+	int i, t;
+
+	for (;;) {
+		t = deque_pop(&pool->deques[ worker->index ]);
+		for (i=1; t < 0 && i<pool->numworkers; i++) {
+			t = deque_steal(&pool->deques[ (worker->index + i) % pool->numworkers ]);
+		}
+		if (t < 0) {
+			// Tasks never spawn tasks, so empty deques stay empty
+			return NULL;
+		}
+
+		RenderTask *task = &pool->tasks[t];
+		double start = now_seconds();
+		task->failed = render_tune(pool->opt, task->tune_path, task->output_path, &task->samples) != 0;
+		task->seconds = now_seconds() - start;
+
+		pthread_mutex_lock(&pool->report_lock);
+		if (task->failed) {
+			fprintf(stderr, "%s: failed\n", task->tune_path);
+		} else {
+			fprintf(stderr, "%s: %.1f s of audio in %.3f s, %.2f Msamples/s, %.0fx realtime\n",
+				task->tune_path,
+				(double)task->samples / pool->opt->rate,
+				task->seconds,
+				task->samples / task->seconds / 1e6,
+				(double)task->samples / pool->opt->rate / task->seconds);
+		}
+		pthread_mutex_unlock(&pool->report_lock);
+	}
+}
+
+
+int deque_pop(RenderDeque *d) {
+	int t = -1;
+	pthread_mutex_lock(&d->lock);
+	if (d->bottom > d->top) {
+		t = d->task[ --d->bottom ];
+	}
+	pthread_mutex_unlock(&d->lock);
+	return t;
+}
+
+
+int deque_steal(RenderDeque *d) {
+	int t = -1;
+	pthread_mutex_lock(&d->lock);
+	if (d->bottom > d->top) {
+		t = d->task[ d->top++ ];
+	}
+	pthread_mutex_unlock(&d->lock);
+	return t;
+}
+
+
+int collect_tasks(RenderOptions *opt, RenderTask **ptasks) {
+	int i, numtasks = 0;
+	struct stat st;
+
+	for (i=0; i<opt->numinputs; i++) {
+		const char *input = opt->inputs[i];
+
+		if (stat(input, &st) != 0) {
+			perror(input);
+			return -1;
+		}
+		if (S_ISDIR(st.st_mode)) {
+			//
+			// Every .PIS file of the directory, in name order
+			//
+			int first = numtasks;
+			DIR *dir = opendir(input);
+			struct dirent *entry;
+			if (!dir) {
+				perror(input);
+				return -1;
+			}
+			while ((entry = readdir(dir)) != NULL) {
+				size_t len = strlen(entry->d_name);
+				if (len > 4 && strcasecmp(entry->d_name + len - 4, ".pis") == 0) {
+					char *path = malloc(strlen(input) + len + 2);
+					if (!path) {
+						fprintf(stderr, "pisrender: out of memory\n");
+						closedir(dir);
+						return -1;
+					}
+					sprintf(path, "%s/%s", input, entry->d_name);
+					if (add_task(opt, ptasks, &numtasks, path) != 0) {
+						free(path);
+						closedir(dir);
+						return -1;
+					}
+					free(path);
+				}
+			}
+			closedir(dir);
+			qsort(*ptasks + first, numtasks - first, sizeof(RenderTask), compare_tasks);
+		} else if (add_task(opt, ptasks, &numtasks, input) != 0) {
+			return -1;
+		}
+	}
+	return numtasks;
+}
+
+
+int add_task(RenderOptions *opt, RenderTask **ptasks, int *numtasks, const char *tune_path) {
+	const char *dir = opt->output_dir ? opt->output_dir : ".";
+	const char *base = strrchr(tune_path, '/');
+	const char *ext;
+	RenderTask *tasks, *task;
+	size_t stem;
+
+	base = base ? base + 1 : tune_path;
+	ext = strrchr(base, '.');
+	stem = ext ? (size_t)(ext - base) : strlen(base);
+
+	tasks = realloc(*ptasks, (*numtasks + 1) * sizeof(RenderTask));
+	if (!tasks) {
+		fprintf(stderr, "pisrender: out of memory\n");
+		return -1;
+	}
+	*ptasks = tasks;
+	task = &tasks[ (*numtasks)++ ];
+	memset(task, 0, sizeof(RenderTask));
+
+	task->tune_path = strdup(tune_path);
+	task->output_path = malloc(strlen(dir) + stem + 6);
+	if (!task->tune_path || !task->output_path) {
+		free(task->tune_path);
+		free(task->output_path);
+		(*numtasks)--;
+		fprintf(stderr, "pisrender: out of memory\n");
+		return -1;
+	}
+	sprintf(task->output_path, "%s/%.*s.%s", dir, (int)stem, base,
+		opt->raw ? "raw" : "wav");
+	return 0;
+}
+
+
+int compare_tasks(const void *a, const void *b) {
+	return strcmp(((const RenderTask *)a)->tune_path, ((const RenderTask *)b)->tune_path);
+}
+
+
+//
+// Tune pack: every module as it is on disk, indexed by file name with
+// the play time pisplay_load_and_play would simulate, and the .pisc
+// image --cache would write for it
+//
+int write_pack(RenderOptions *opt) {
+	RenderTask *tasks = NULL;
+	PisPlayer *player;
+	PisPackHeader header;
+	PisPackEntry *entry;
+	uint8_t **data;
+	FILE *out;
+	uint32_t offset;
+	int numtasks, i, result = 1;
+
+	numtasks = collect_tasks(opt, &tasks);
+	player = pisplay_create(opt->rate);
+	if (numtasks < 0 || !player) {
+		return 1;
+	}
+	entry = calloc(numtasks, sizeof(PisPackEntry));
+	data = calloc(numtasks, sizeof(uint8_t *));
+	if (!entry || !data) {
+		fprintf(stderr, "pisrender: out of memory\n");
+		goto done;
+	}
+
+	offset = sizeof(PisPackHeader) + numtasks * sizeof(PisPackEntry);
+	for (i=0; i<numtasks; i++) {
+		const char *path = tasks[i].tune_path;
+		const char *name = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+		PisSongInfo info;
+		size_t size;
+		int error;
+
+		if (strlen(name) >= PIS_PACK_NAME_SIZE) {
+			fprintf(stderr, "%s: name longer than %d characters\n", path, PIS_PACK_NAME_SIZE - 1);
+			goto done;
+		}
+		error = read_file(path, &data[i], &size);
+		if (error == PIS_OK) {
+			error = pisplay_load_from_memory(player, data[i], size);
+		}
+		if (error != PIS_OK) {
+			fprintf(stderr, "%s: %s\n", path, pisplay_error_string(error));
+			goto done;
+		}
+		if (pisplay_simulate(player, &info, PIS_SIMULATE_MAX_FRAMES) != 0) {
+			fprintf(stderr, "pisrender: out of memory\n");
+			goto done;
+		}
+
+		strcpy(entry[i].name, name);
+		entry[i].offset = offset;
+		entry[i].size = size;
+		entry[i].duration_frames = info.ends
+								 ? info.length_frames + PIS_END_TAIL_FRAMES
+								 : info.length_frames;
+		entry[i].hash = pisplay_hash(data[i], size);
+		offset += size;
+	}
+
+	out = fopen(opt->pack_path, "wb");
+	if (!out) {
+		perror(opt->pack_path);
+		goto done;
+	}
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, PIS_PACK_MAGIC, sizeof(header.magic));
+	header.version = PIS_PACK_VERSION;
+	header.count = numtasks;
+	result = fwrite(&header, sizeof(header), 1, out) != 1
+		  || fwrite(entry, sizeof(PisPackEntry), numtasks, out) != (size_t)numtasks;
+	for (i=0; i<numtasks && !result; i++) {
+		result = fwrite(data[i], 1, entry[i].size, out) != entry[i].size;
+	}
+
+	//
+	// Each tune's .pisc image, aligned to be used in place, then the
+	// index again with where the images went
+	//
+	for (i=0; i<numtasks && !result; i++) {
+		static const uint8_t zero[PIS_CACHE_ALIGN];
+		PisLevels levels;
+
+		entry[i].cache_offset = cache_align(offset);
+		if (fwrite(zero, 1, entry[i].cache_offset - offset, out) != entry[i].cache_offset - offset) {
+			result = 1;
+			break;
+		}
+		if (pisplay_load_from_memory(player, data[i], entry[i].size) != PIS_OK
+			|| measure_levels(player, &levels) != 0) {
+			fprintf(stderr, "pisrender: out of memory\n");
+			fclose(out);
+			result = 1;
+			goto done;
+		}
+		result = pisplay_write_cache_image(player, out, data[i], entry[i].size, &levels) != 0;
+		offset = ftell(out);
+		entry[i].cache_size = offset - entry[i].cache_offset;
+	}
+	if (!result) {
+		result = fseek(out, sizeof(header), SEEK_SET) != 0
+			  || fwrite(entry, sizeof(PisPackEntry), numtasks, out) != (size_t)numtasks;
+	}
+	if (fclose(out) != 0 || result) {
+		perror(opt->pack_path);
+		result = 1;
+	} else {
+		fprintf(stderr, "%s: %d tunes, %u bytes\n", opt->pack_path, numtasks, offset);
+	}
+
+done:
+	for (i=0; i<numtasks; i++) {
+		if (data) free(data[i]);
+		free(tasks[i].tune_path);
+		free(tasks[i].output_path);
+	}
+	free(data);
+	free(entry);
+	free(tasks);
+	pisplay_destroy(player);
+	return result;
+}
+
+
+//
+// .pisc for every tune: the seek index the player would build on its
+// first seek, plus the levels over the play time at the chosen rate
+//
+int write_caches(RenderOptions *opt) {
+	RenderTask *tasks = NULL;
+	PisPlayer *player;
+	int numtasks, i, failed = 0;
+
+	numtasks = collect_tasks(opt, &tasks);
+	player = pisplay_create(opt->rate);
+	if (numtasks < 0 || !player) {
+		return 1;
+	}
+
+	for (i=0; i<numtasks; i++) {
+		const char *path = tasks[i].tune_path;
+		char cache_path[PIS_PATH_MAX];
+		PisLevels levels;
+		uint8_t *data = NULL;
+		size_t size;
+		int error = read_file(path, &data, &size);
+
+		if (error == PIS_OK) {
+			error = pisplay_load_from_memory(player, data, size);
+		}
+		if (error != PIS_OK) {
+			fprintf(stderr, "%s: %s\n", path, pisplay_error_string(error));
+			failed = 1;
+		} else {
+			pisplay_cache_path(cache_path, sizeof(cache_path), path);
+			if (measure_levels(player, &levels) != 0
+				|| pisplay_write_cache(player, cache_path, data, size, &levels) != 0) {
+				perror(cache_path);
+				failed = 1;
+			} else {
+				printf("%s: peak %.3f, loudness %.1f dBFS\n", cache_path, levels.peak, levels.loudness);
+			}
+		}
+		free(data);
+		free(tasks[i].tune_path);
+		free(tasks[i].output_path);
+	}
+
+	pisplay_destroy(player);
+	free(tasks);
+	return failed;
+}
+
+
+// Peak and RMS of the play time pisplay_load_and_play gives the tune
+int measure_levels(PisPlayer *player, PisLevels *levels) {
+	INT16 *block = malloc(RENDER_BLOCK_SAMPLES * sizeof(INT16));
+	PisSongInfo info;
+	double sum = 0;
+	long total_samples, rendered = 0;
+	int peak = 0;
+
+	if (!block || pisplay_simulate(player, &info, PIS_SIMULATE_MAX_FRAMES) != 0) {
+		free(block);
+		return -1;
+	}
+	total_samples = (info.ends ? info.length_frames + PIS_END_TAIL_FRAMES : info.length_frames)
+				  * player->samples_per_frame;
+	while (rendered < total_samples) {
+		int numsamples = (total_samples - rendered > RENDER_BLOCK_SAMPLES)
+					   ? RENDER_BLOCK_SAMPLES
+					   : total_samples - rendered;
+		if (pisplay_render(player, block, numsamples) != 0) {
+			free(block);
+			return -1;
+		}
+		for (int i=0; i<numsamples; i++) {
+			int magnitude = abs(block[i]);
+			if (magnitude > peak) peak = magnitude;
+			sum += (double)block[i] * block[i];
+		}
+		rendered += numsamples;
+	}
+	free(block);
+
+	memset(levels, 0, sizeof(PisLevels));
+	levels->peak = peak / 32768.0;
+	levels->loudness = sum > 0
+					 ? 10 * log10(sum / total_samples / (32768.0 * 32768.0))
+					 : RENDER_SILENCE_DBFS;
+	levels->rate = player->samples_per_frame * 50;
+	return 0;
+}
+
+
+void usage(const char *argv0) {
+	fprintf(stderr,
+		"usage: %s [options] tune.PIS output.wav\n"
+		"       %s [options] -o outdir [-j threads] tune.PIS|directory ...\n"
+		"  -r rate       sample rate in Hz (default %d)\n"
+		"  -c channels   1..%d, the mono chip output is copied to each (default 1)\n"
+		"  -f format     u8, s16, s24, s32 or f32 (default s16)\n"
+		"  -n frames     stop after this many 50 Hz replay frames\n"
+		"  -s seconds    stop after this many seconds\n"
+		"                (default: up to the loop point, or the end and %d frames)\n"
+		"  -t seconds    start playing at this time\n"
+		"  -p pos[:row]  start playing where this order position and row is first reached\n"
+		"  --raw         headerless little-endian PCM instead of WAV, which ends\n"
+		"                at 4 GiB\n"
+		"  -o outdir     batch mode: render every tune into outdir\n"
+		"  -j threads    worker threads, for the tunes of a batch or the segments\n"
+		"                of a single tune written to a file (default: all cores)\n"
+		"  --info        print play time and loop point of each tune, render nothing\n"
+		"  --bench       measure replay speed in rows/s without synthesis, render nothing\n"
+		"  --compile     replay through the row compiler instead of the interpreter\n"
+		"  --verify      check that both replay the same OPL writes, render nothing\n"
+		"  --pack file   write the tunes into one tune pack, render nothing\n"
+		"  --cache       write a .pisc next to each tune for the player, render nothing\n"
+		"output '-' writes to stdout\n",
+		argv0, argv0, RENDER_DEFAULT_RATE, RENDER_MAX_CHANNELS, PIS_END_TAIL_FRAMES);
+}
+
+
+int parse_options(int argc, char **argv, RenderOptions *opt) {
+	int i, f;
+
+	memset(opt, 0, sizeof(RenderOptions));
+	opt->rate = RENDER_DEFAULT_RATE;
+	opt->channels = 1;
+	opt->format = &render_formats[ FORMAT_S16 ];
+	opt->start_position = PIS_NONE;
+	opt->threads = sysconf(_SC_NPROCESSORS_ONLN);
+	opt->inputs = calloc(argc, sizeof(char *));
+
+	for (i=1; i<argc; i++) {
+		if (strcmp(argv[i], "--raw") == 0) {
+			opt->raw = 1;
+		} else if (strcmp(argv[i], "--info") == 0) {
+			opt->info = 1;
+		} else if (strcmp(argv[i], "--bench") == 0) {
+			opt->bench = 1;
+		} else if (strcmp(argv[i], "--compile") == 0) {
+			opt->compile = 1;
+		} else if (strcmp(argv[i], "--verify") == 0) {
+			opt->verify = 1;
+		} else if (strcmp(argv[i], "--cache") == 0) {
+			opt->cache = 1;
+		} else if (strcmp(argv[i], "--pack") == 0) {
+			if (i + 1 >= argc) return -1;
+			opt->pack_path = argv[++i];
+		} else if (argv[i][0] == '-' && argv[i][1] && argv[i][2] == 0) {
+			if (i + 1 >= argc) return -1;
+			switch (argv[i][1]) {
+				case 'r':
+					opt->rate = atoi(argv[++i]);
+					break;
+				case 'c':
+					opt->channels = atoi(argv[++i]);
+					break;
+				case 'f':
+					i++;
+					opt->format = NULL;
+					for (f=0; f<(int)(sizeof(render_formats)/sizeof(render_formats[0])); f++) {
+						if (strcmp(argv[i], render_formats[f].name) == 0) {
+							opt->format = &render_formats[f];
+						}
+					}
+					if (!opt->format) return -1;
+					break;
+				case 'n':
+					opt->max_frames = atol(argv[++i]);
+					break;
+				case 's':
+					opt->max_frames = atof(argv[++i]) * 50;
+					break;
+				case 't':
+					opt->start_seconds = atof(argv[++i]);
+					break;
+				case 'p':
+					i++;
+					opt->start_row = 0;
+					if (sscanf(argv[i], "%d:%d", &opt->start_position, &opt->start_row) < 1) {
+						return -1;
+					}
+					break;
+				case 'o':
+					opt->output_dir = argv[++i];
+					break;
+				case 'j':
+					opt->threads = atoi(argv[++i]);
+					break;
+				default:
+					return -1;
+			}
+		} else {
+			opt->inputs[ opt->numinputs++ ] = argv[i];
+		}
+	}
+
+	if (opt->output_dir || opt->info || opt->bench || opt->verify || opt->pack_path || opt->cache) {
+		if (opt->numinputs < 1) return -1;
+		if (opt->threads < 1) opt->threads = 1;
+		if (opt->threads > RENDER_MAX_THREADS) opt->threads = RENDER_MAX_THREADS;
+	} else {
+		if (opt->numinputs != 2) return -1;
+		opt->tune_path = opt->inputs[0];
+		opt->output_path = opt->inputs[1];
+	}
+	// 50 samples per frame at the least, so that the replay keeps time
+	if (opt->rate < 50 || opt->rate > 384000) return -1;
+	if (opt->channels < 1 || opt->channels > RENDER_MAX_CHANNELS) return -1;
+	if (opt->max_frames < 0) return -1;
+	if (opt->start_seconds < 0) return -1;
+	return 0;
+}
+
+
+void put_le(uint8_t *p, uint32_t v, int bytes) {
+	while (bytes--) {
+		*p++ = v & 0xff;
+		v >>= 8;
+	}
+}
+
+
+void write_wav_header(FILE *f, RenderOptions *opt, uint32_t numframes) {
+	//
+	// WAVE_FORMAT_EXTENSIBLE for more than two channels or more than 16
+	// bits, as the format asks for; the plain header otherwise
+	//
+	static const uint8_t subformat_tail[14] = {
+		0x00,0x00,0x00,0x00,0x10,0x00,0x80,0x00,0x00,0xaa,0x00,0x38,0x9b,0x71
+	};
+	uint8_t h[68];
+	int bits = opt->format->bytes * 8;
+	int tag = opt->format->is_float ? WAVE_FORMAT_IEEE_FLOAT : WAVE_FORMAT_PCM;
+	int extensible = opt->channels > 2 || bits > 16;
+	uint32_t fmt_size = extensible ? 40 : 16;
+	uint32_t block_align = opt->channels * opt->format->bytes;
+	uint32_t data_size = numframes * block_align;
+	uint8_t *p = h;
+
+	memcpy(p, "RIFF", 4);                          p += 4;
+	put_le(p, 4 + 8 + fmt_size + 8 + data_size, 4); p += 4;
+	memcpy(p, "WAVEfmt ", 8);                      p += 8;
+	put_le(p, fmt_size, 4);                        p += 4;
+	put_le(p, extensible ? WAVE_FORMAT_EXTENSIBLE : tag, 2); p += 2;
+	put_le(p, opt->channels, 2);                   p += 2;
+	put_le(p, opt->rate, 4);                       p += 4;
+	put_le(p, opt->rate * block_align, 4);         p += 4;
+	put_le(p, block_align, 2);                     p += 2;
+	put_le(p, bits, 2);                            p += 2;
+	if (extensible) {
+		put_le(p, 22, 2);                          p += 2;
+		put_le(p, bits, 2);                        p += 2; // valid bits
+		put_le(p, 0, 4);                           p += 4; // channel mask
+		put_le(p, tag, 2);                         p += 2; // subformat GUID
+		memcpy(p, subformat_tail, 14);             p += 14;
+	}
+	memcpy(p, "data", 4);                          p += 4;
+	put_le(p, data_size, 4);                       p += 4;
+
+	fwrite(h, 1, p - h, f);
+}
+
+
+void convert_block(RenderOptions *opt, INT16 *source, uint8_t *destination, int numsamples) {
+	int c, bytes = opt->format->bytes;
+	uint8_t sample[4];
+
+	while (numsamples--) {
+		int32_t v = *source++;
+		switch (opt->format->format) {
+			case FORMAT_U8:
+				sample[0] = (v >> 8) + 128;
+				break;
+			case FORMAT_S16:
+				put_le(sample, v, 2);
+				break;
+			case FORMAT_S24:
+				put_le(sample, (uint32_t)v << 8, 3);
+				break;
+			case FORMAT_S32:
+				put_le(sample, (uint32_t)v << 16, 4);
+				break;
+			case FORMAT_F32: {
+				float fv = (float)v / 32768.0f;
+				uint32_t bits;
+				memcpy(&bits, &fv, 4);
+				put_le(sample, bits, 4);
+				break;
+			}
+		}
+		for (c=0; c<opt->channels; c++) {
+			memcpy(destination, sample, bytes);
+			destination += bytes;
+		}
+	}
+}